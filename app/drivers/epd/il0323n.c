@@ -1,6 +1,8 @@
 #define DT_DRV_COMPAT gooddisplay_il0323n
 
 #include "il0323n.h"
+#include "il0323n_emul.h"
+#include <drivers/gpio.h>
 #include <drivers/spi.h>
 #include <string.h>
 
@@ -30,8 +32,50 @@ LOG_MODULE_REGISTER(il0323n, CONFIG_DISPLAY_LOG_LEVEL);
 // Clamp bound values
 #define IL0323_CLAMP_BOUNDS
 
-// How many times to refresh before doing a double reset
-#define IL0323_EXTRA_REFRESH_INT 5
+// Bytes per framebuffer row
+#define IL0323_ROW_BYTES (EPD_PANEL_WIDTH / 8)
+
+// Maximum number of separately uploaded rectangles per refresh
+#define IL0323_MAX_DIRTY_RECTS 4
+
+// Changed rows closer together than this are uploaded as one rectangle
+#define IL0323_DIRTY_MERGE_ROWS 4
+
+// Pixel transitions driven by partial refreshes before the area is cleaned with a double refresh
+#define IL0323_GHOSTING_LIMIT (EPD_PANEL_WIDTH * EPD_PANEL_HEIGHT / 2)
+
+// Ghosting worth cleaning up when the caller reports the panel idle, see il0323_clean_start
+#define IL0323_IDLE_CLEAN_LIMIT (IL0323_GHOSTING_LIMIT / 4)
+
+// Rough energy estimates from typical datasheet currents at 3V, for comparing refresh and power
+// strategies rather than measuring absolute consumption
+#define IL0323_ENERGY_WAKE_UJ 150
+#define IL0323_ENERGY_POWER_ON_UJ 300
+#define IL0323_ENERGY_POWERED_UW 600
+#define IL0323_ENERGY_PARTIAL_REFRESH_UJ 2700
+#define IL0323_ENERGY_FULL_REFRESH_UJ 13500
+#define IL0323_ENERGY_BYTE_NJ 20
+
+// Byte aligned framebuffer rectangle, x in bytes and y in rows, end exclusive
+struct il0323_rect {
+    uint8_t x0;
+    uint8_t x1;
+    uint8_t y0;
+    uint8_t y1;
+};
+
+struct il0323_refresh_state {
+    // Requested window, kept for the clean up refresh
+    struct il0323_rect window;
+    struct il0323_rect rects[IL0323_MAX_DIRTY_RECTS];
+    uint8_t count;
+    uint8_t full;
+    // Set while the running refresh is the double refresh cleaning up ghosting
+    uint8_t clean;
+    uint32_t flips;
+    // Caller's completion callback, also used for the clean up refresh
+    il0323_refresh_cb_t done;
+};
 
 struct il0323_data {
     const struct device *reset;
@@ -45,8 +89,18 @@ struct il0323_data {
     uint8_t power_on;
     uint8_t partial_mode;
     uint8_t hibernating;
-    // Partial refresh count for IL0323_EXTRA_REFRESH_INT
-    uint16_t p_refresh_cnt;
+    // Set while the old (0x10) and new (0x13) controller RAM both hold il0323_last_buffer
+    uint8_t ram_valid;
+    // Pixel transitions since the last clean refresh, see IL0323_GHOSTING_LIMIT
+    uint32_t ghosting;
+    // Refresh started by il0323_refresh_start, completed by il0323_refresh_finish
+    struct il0323_refresh_state refresh;
+    // Called from the busy interrupt once the running refresh is done
+    il0323_refresh_cb_t refresh_done;
+    struct gpio_callback busy_cb;
+    // Activity since boot, energy_uj only holds the fixed costs, see il0323_get_stats
+    struct il0323_stats stats;
+    int64_t powered_since;
 };
 
 // Pixel buffer
@@ -127,6 +181,51 @@ const static uint8_t IL0323_LUT_B_PARTIAL[] =
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
+/**
+ * @brief Sends bytes to the controller
+ * 
+ * @param driver 
+ * @param command true for command bytes, false for data
+ * @param buf 
+ * @param len 
+ * @return int 
+ */
+static int il0323_bus_write (struct il0323_data *driver, bool command, const uint8_t *buf,
+                             size_t len) {
+    if(!command) {
+        driver->stats.bytes += len;
+    }
+
+#if IS_ENABLED(CONFIG_IL0323N_EMUL)
+    il0323_emul_write(command, buf, len);
+    return 0;
+#else
+    struct spi_buf data = {.buf = (uint8_t *)buf, .len = len};
+    struct spi_buf_set data_set = {.buffers = &data, .count = 1};
+
+    gpio_pin_set(driver->dc, IL0323_DC_PIN, command);
+    if (spi_write(driver->spi_dev, &driver->spi_config, &data_set)) {
+        return -EIO;
+    }
+
+    return 0;
+#endif
+}
+
+/**
+ * @brief Reads the busy line
+ * 
+ * @param driver 
+ * @return int 1 while busy
+ */
+static int il0323_bus_busy (struct il0323_data *driver) {
+#if IS_ENABLED(CONFIG_IL0323N_EMUL)
+    return il0323_emul_busy();
+#else
+    return gpio_pin_get(driver->busy, IL0323_BUSY_PIN);
+#endif
+}
+
 /**
  * @brief IL0323 Write register
  * 
@@ -138,19 +237,12 @@ const static uint8_t IL0323_LUT_B_PARTIAL[] =
  */
 static int il0323_write_reg(struct il0323_data *driver, uint8_t reg, uint8_t *data,
                                    size_t len) {
-    struct spi_buf buf = {.buf = &reg, .len = sizeof(reg)};
-    struct spi_buf_set buf_set = {.buffers = &buf, .count = 1};
-
-    gpio_pin_set(driver->dc, IL0323_DC_PIN, 1);
-    if (spi_write(driver->spi_dev, &driver->spi_config, &buf_set)) {
+    if (il0323_bus_write(driver, true, &reg, sizeof(reg))) {
         return -EIO;
     }
     
     if (data != NULL) {
-        buf.buf = data;
-        buf.len = len;
-        gpio_pin_set(driver->dc, IL0323_DC_PIN, 0);
-        if (spi_write(driver->spi_dev, &driver->spi_config, &buf_set)) {
+        if (il0323_bus_write(driver, false, data, len)) {
             return -EIO;
         }
     }
@@ -165,12 +257,12 @@ static int il0323_write_reg(struct il0323_data *driver, uint8_t reg, uint8_t *da
  * @param driver 
  */
 static int il0323_busy_wait(struct il0323_data *driver) {
-    int pin = gpio_pin_get(driver->busy, IL0323_BUSY_PIN);
+    int pin = il0323_bus_busy(driver);
 
     while (pin > 0) {
         // LOG_DBG("wait %u", pin);
         k_msleep(1);
-        pin = gpio_pin_get(driver->busy, IL0323_BUSY_PIN);
+        pin = il0323_bus_busy(driver);
     }
 
     return 0;
@@ -187,9 +279,16 @@ static int il0323_reset (struct il0323_data *driver) {
     gpio_pin_set(driver->reset, IL0323_RESET_PIN, 1);
     k_msleep(10);
     gpio_pin_set(driver->reset, IL0323_RESET_PIN, 0);
+#if IS_ENABLED(CONFIG_IL0323N_EMUL)
+    il0323_emul_reset();
+#endif
     k_msleep(10);
     il0323_busy_wait(driver);
     driver->hibernating = false;
+    // Controller RAM doesn't survive the reset
+    driver->ram_valid = false;
+    driver->stats.wakes++;
+    driver->stats.energy_uj += IL0323_ENERGY_WAKE_UJ;
     return 0;
 }
 
@@ -215,11 +314,53 @@ static int il0323_power (struct il0323_data *driver, uint8_t on) {
 
     driver->power_on = on;
 
+    if(on) {
+        driver->stats.power_ons++;
+        driver->stats.energy_uj += IL0323_ENERGY_POWER_ON_UJ;
+        driver->powered_since = k_uptime_get();
+    } else {
+        driver->stats.energy_uj +=
+            (k_uptime_get() - driver->powered_since) * IL0323_ENERGY_POWERED_UW / 1000;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Triggers a refresh of the current area, accounting for its energy
+ * 
+ * @param driver 
+ * @param full 
+ * @return int 
+ */
+static int il0323_trigger_refresh (struct il0323_data *driver, bool full) {
+    if (il0323_write_reg(driver, 0x12, NULL, 0)) {
+        return -EIO;
+    }
+
+    driver->stats.refreshes++;
+    if(full) {
+        driver->stats.full_refreshes++;
+    }
+    driver->stats.energy_uj +=
+        full ? IL0323_ENERGY_FULL_REFRESH_UJ : IL0323_ENERGY_PARTIAL_REFRESH_UJ;
+
     return 0;
 }
 
+int il0323_power_off (const struct device *dev) {
+    struct il0323_data *driver = dev->data;
+
+    return il0323_power(driver, false);
+}
+
 int il0323_hibernate (const struct device *dev) {
     struct il0323_data *driver = dev->data;
+
+    if(driver->hibernating) {
+        return 0;
+    }
+
     // Switch off power
     if(il0323_power(driver, false)) {
         return -EIO;
@@ -232,6 +373,19 @@ int il0323_hibernate (const struct device *dev) {
     }
 
     driver->hibernating = true;
+
+    return 0;
+}
+
+void il0323_get_stats (const struct device *dev, struct il0323_stats *stats) {
+    struct il0323_data *driver = dev->data;
+
+    *stats = driver->stats;
+    stats->energy_uj += (uint64_t)stats->bytes * IL0323_ENERGY_BYTE_NJ / 1000;
+    if(driver->power_on) {
+        stats->energy_uj +=
+            (k_uptime_get() - driver->powered_since) * IL0323_ENERGY_POWERED_UW / 1000;
+    }
 }
 
 
@@ -341,15 +495,14 @@ static int il0323_driver_init_partial (const struct device *dev) {
 /**
  * @brief Sets the drawable area
  * 
- * @param dev 
+ * @param driver 
  * @param x 
  * @param y 
  * @param w 
  * @param h 
  * @return int 
  */
-static int il0323_set_area (struct device *dev, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
-    struct il0323_data *driver = dev->data;
+static int il0323_set_area (struct il0323_data *driver, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
     uint8_t bounds[] = {
         x & 0xFFF8,
         (x + w - 1) | 0x0007, // byte boundary inclusive (last byte)
@@ -383,20 +536,146 @@ static int il0323_init_buffer (struct device *dev) {
             return -EIO;
     }
 
+    driver->ram_valid = true;
+
     return 0;
 }
 
-int il0323_refresh (struct device *dev, int16_t x, int16_t y, int16_t w, int16_t h) {
+/**
+ * @brief Writes the rows of a rectangle to the controller RAM, partial mode must be on
+ * 
+ * @param driver 
+ * @param reg 0x10 for old data, 0x13 for new data
+ * @param buf 
+ * @param rect 
+ * @return int 
+ */
+static int il0323_write_rect (struct il0323_data *driver, uint8_t reg, const uint8_t *buf,
+                              const struct il0323_rect *rect) {
+    // Data written while in partial mode only fills the current window
+    if(il0323_set_area(driver, rect->x0 * 8, rect->y0, (rect->x1 - rect->x0) * 8, rect->y1 - rect->y0)) {
+        return -EIO;
+    }
 
-    struct il0323_data *driver = dev->data;
+    if (il0323_write_reg(driver, reg, NULL, 0)) {
+        return -EIO;
+    }
 
-    if(driver->hibernating) {
-        // Reset
-        il0323_reset(driver);
-        k_msleep(10);
-        il0323_driver_init_partial(dev);
+    for(int row = rect->y0; row < rect->y1; row++) {
+        if (il0323_bus_write(driver, false, &buf[row * IL0323_ROW_BYTES + rect->x0],
+                             rect->x1 - rect->x0)) {
+            return -EIO;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Finds the rectangles of a window that differ from what is on screen
+ * 
+ * @param window 
+ * @param rects at least IL0323_MAX_DIRTY_RECTS entries
+ * @param flips incremented by the number of changed pixels
+ * @return int number of rectangles
+ */
+static int il0323_find_dirty (const struct il0323_rect *window, struct il0323_rect *rects,
+                              uint32_t *flips) {
+    int count = 0;
+
+    for(int row = window->y0; row < window->y1; row++) {
+        int first = -1;
+        int last = -1;
+
+        for(int col = window->x0; col < window->x1; col++) {
+            uint8_t diff = il0323_buffer[row * IL0323_ROW_BYTES + col] ^
+                           il0323_last_buffer[row * IL0323_ROW_BYTES + col];
+            if(diff) {
+                if(first < 0) {
+                    first = col;
+                }
+                last = col;
+                *flips += __builtin_popcount(diff);
+            }
+        }
+
+        if(first < 0) {
+            continue;
+        }
+
+        struct il0323_rect *rect = count > 0 ? &rects[count - 1] : NULL;
+
+        // Start a new rectangle after a gap, unless they've run out
+        if(rect == NULL ||
+           (row - rect->y1 >= IL0323_DIRTY_MERGE_ROWS && count < IL0323_MAX_DIRTY_RECTS)) {
+            rects[count++] = (struct il0323_rect){
+                .x0 = first, .x1 = last + 1, .y0 = row, .y1 = row + 1};
+            continue;
+        }
+
+        rect->x0 = MIN(rect->x0, first);
+        rect->x1 = MAX(rect->x1, last + 1);
+        rect->y1 = row + 1;
     }
 
+    return count;
+}
+
+/**
+ * @brief Arms the busy interrupt to report the end of the refresh about to be triggered
+ * 
+ * @param driver 
+ * @param done NULL when the caller waits for the panel itself
+ */
+static void il0323_busy_done (struct il0323_data *driver) {
+    il0323_refresh_cb_t done = driver->refresh_done;
+    driver->refresh_done = NULL;
+    if(done != NULL) {
+        done(DEVICE_DT_INST_GET(0));
+    }
+}
+
+#if IS_ENABLED(CONFIG_IL0323N_EMUL)
+
+static void il0323_emul_idle (void *user_data) {
+    il0323_busy_done(user_data);
+}
+
+static void il0323_arm_busy (struct il0323_data *driver, il0323_refresh_cb_t done) {
+    driver->refresh_done = done;
+    il0323_emul_on_idle(done != NULL ? il0323_emul_idle : NULL, driver);
+}
+
+#else
+
+static void il0323_arm_busy (struct il0323_data *driver, il0323_refresh_cb_t done) {
+    driver->refresh_done = done;
+    if(done != NULL) {
+        gpio_pin_interrupt_configure(driver->busy, IL0323_BUSY_PIN, GPIO_INT_EDGE_TO_INACTIVE);
+    }
+}
+
+#endif
+
+static void il0323_busy_callback (const struct device *port, struct gpio_callback *cb,
+                                  gpio_port_pins_t pins) {
+    struct il0323_data *driver = CONTAINER_OF(cb, struct il0323_data, busy_cb);
+
+    gpio_pin_interrupt_configure(driver->busy, IL0323_BUSY_PIN, GPIO_INT_DISABLE);
+
+    il0323_busy_done(driver);
+}
+
+/**
+ * @brief Uploads both full buffers and starts refreshing the whole panel
+ * 
+ * @param dev 
+ * @param done 
+ * @return int 
+ */
+static int il0323_refresh_full_start (const struct device *dev, il0323_refresh_cb_t done) {
+    struct il0323_data *driver = dev->data;
+
     // Init old data
     if (il0323_write_reg(driver, 0x10, il0323_last_buffer, sizeof(il0323_last_buffer))) {
         return -EIO;
@@ -408,71 +687,393 @@ int il0323_refresh (struct device *dev, int16_t x, int16_t y, int16_t w, int16_t
     }
 
     memcpy(il0323_last_buffer, il0323_buffer, sizeof(il0323_last_buffer));
+    // Old data in RAM is now behind
+    driver->ram_valid = false;
 
-    il0323_power(dev->data, true);
+    il0323_power(driver, true);
 
-    if(!driver->partial_mode) {
-        // Full refresh
-        if (il0323_write_reg(driver, 0x12, NULL, 0)) {
-            return -EIO;
-        }
+    driver->refresh.full = true;
+    il0323_arm_busy(driver, done);
 
-        // Wait until refreshed
-        il0323_busy_wait(driver);
+    // Full refresh
+    if (il0323_trigger_refresh(driver, true)) {
+        il0323_arm_busy(driver, NULL);
+        return -EIO;
+    }
+
+    return 1;
+}
+
+/**
+ * @brief Uploads the changed parts of a window and starts refreshing them
+ * 
+ * @param dev 
+ * @param window 
+ * @param done 
+ * @return int 1 if the panel is refreshing, 0 if nothing changed
+ */
+static int il0323_refresh_window_start (const struct device *dev, const struct il0323_rect *window,
+                                        il0323_refresh_cb_t done) {
+    struct il0323_data *driver = dev->data;
+    struct il0323_refresh_state *refresh = &driver->refresh;
+
+    refresh->window = *window;
+    refresh->flips = 0;
+    refresh->full = false;
+    refresh->count = il0323_find_dirty(window, refresh->rects, &refresh->flips);
+
+    // Nothing in the window changed, skip the waveform altogether
+    if(refresh->count == 0) {
         return 0;
     }
 
-    int16_t w1 = x < 0 ? w + x : w; // reduce
-    int16_t h1 = y < 0 ? h + y : h; // reduce
-    int16_t x1 = x < 0 ? 0 : x; // limit
-    int16_t y1 = y < 0 ? 0 : y; // limit
-    w1 = x1 + w1 < (int16_t)EPD_PANEL_WIDTH ? w1 : (int16_t)EPD_PANEL_WIDTH - x1; // limit
-    h1 = y1 + h1 < (int16_t)EPD_PANEL_HEIGHT ? h1 : (int16_t)EPD_PANEL_HEIGHT - y1; // limit
-    if ((w1 <= 0) || (h1 <= 0)) return; 
-    // make x1, w1 multiple of 8
-    w1 += x1 % 8;
-    if (w1 % 8 > 0) w1 += 8 - w1 % 8;
-    x1 -= x1 % 8;
+    if(driver->hibernating) {
+        // Reset
+        il0323_reset(driver);
+        k_msleep(10);
+        il0323_driver_init_partial(dev);
+    }
+
+    if(!driver->partial_mode) {
+        return il0323_refresh_full_start(dev, done);
+    }
+
+    // Refreshed area covering every changed rectangle
+    struct il0323_rect area = refresh->rects[0];
+    for(int i = 1; i < refresh->count; i++) {
+        area.x0 = MIN(area.x0, refresh->rects[i].x0);
+        area.x1 = MAX(area.x1, refresh->rects[i].x1);
+        area.y1 = refresh->rects[i].y1;
+    }
 
     il0323_busy_wait(driver);
 
+    if(!driver->ram_valid) {
+        // RAM content is unknown, e.g. after hibernation, so it all has to be written once
+        if (il0323_write_reg(driver, 0x10, il0323_last_buffer, sizeof(il0323_last_buffer))) {
+            return -EIO;
+        }
+        if (il0323_write_reg(driver, 0x13, il0323_buffer, sizeof(il0323_buffer))) {
+            return -EIO;
+        }
+    }
+
     // Enter partial mode
     if (il0323_write_reg(driver, 0x91, NULL, 0)) {
         return -EIO;
     }
 
+    // Old data in RAM already matches il0323_last_buffer, only new data is sent
+    if(driver->ram_valid) {
+        for(int i = 0; i < refresh->count; i++) {
+            if(il0323_write_rect(driver, 0x13, il0323_buffer, &refresh->rects[i])) {
+                return -EIO;
+            }
+        }
+    }
+
+    il0323_power(driver, true);
+
     // Set area
-    if(il0323_set_area(dev, x1, y1, w1, h1)) {
+    if(il0323_set_area(driver, area.x0 * 8, area.y0, (area.x1 - area.x0) * 8, area.y1 - area.y0)) {
         return -EIO;
     }
     
     il0323_busy_wait(driver);
 
+    il0323_arm_busy(driver, done);
+
     // Update part
-    if (il0323_write_reg(driver, 0x12, NULL, 0)) {
+    if (il0323_trigger_refresh(driver, false)) {
+        il0323_arm_busy(driver, NULL);
         return -EIO;
     }
 
-    // Wait until refreshed
-    il0323_busy_wait(driver);
+    return 1;
+}
+
+int il0323_refresh_start (const struct device *dev, int16_t x, int16_t y, int16_t w, int16_t h,
+                          il0323_refresh_cb_t done) {
+    int16_t w1 = x < 0 ? w + x : w; // reduce
+    int16_t h1 = y < 0 ? h + y : h; // reduce
+    int16_t x1 = x < 0 ? 0 : x; // limit
+    int16_t y1 = y < 0 ? 0 : y; // limit
+    w1 = x1 + w1 < (int16_t)EPD_PANEL_WIDTH ? w1 : (int16_t)EPD_PANEL_WIDTH - x1; // limit
+    h1 = y1 + h1 < (int16_t)EPD_PANEL_HEIGHT ? h1 : (int16_t)EPD_PANEL_HEIGHT - y1; // limit
+    if ((w1 <= 0) || (h1 <= 0)) return 0;
+
+    struct il0323_rect window = {
+        .x0 = x1 / 8,
+        .x1 = (x1 + w1 + 7) / 8,
+        .y0 = y1,
+        .y1 = y1 + h1,
+    };
+
+    struct il0323_data *driver = dev->data;
+    driver->refresh.done = done;
+
+    return il0323_refresh_window_start(dev, &window, done);
+}
+
+/**
+ * @brief Starts a double refresh of a window, redrawing it from white to clean up ghosting
+ * 
+ * @param dev 
+ * @param window 
+ * @return int 1 if the panel is refreshing, 0 if the window is blank
+ */
+static int il0323_clean_window_start (const struct device *dev, const struct il0323_rect *window) {
+    struct il0323_data *driver = dev->data;
+    struct il0323_refresh_state *refresh = &driver->refresh;
+
+    // Reset last buffer to white, to trigger refresh for black pixels
+    for(int row = window->y0; row < window->y1; row++) {
+        memset(&il0323_last_buffer[row * IL0323_ROW_BYTES + window->x0], 0xFF,
+               window->x1 - window->x0);
+    }
+    // RAM no longer matches the last buffer
+    driver->ram_valid = false;
+
+    refresh->clean = true;
+    int ret = il0323_refresh_window_start(dev, window, refresh->done);
+    if(ret <= 0) {
+        refresh->clean = false;
+    }
+    if(ret == 0) {
+        // All white, nothing left to clean
+        driver->ghosting = 0;
+    }
+    return ret;
+}
+
+int il0323_refresh_finish (const struct device *dev) {
+    struct il0323_data *driver = dev->data;
+    struct il0323_refresh_state *refresh = &driver->refresh;
+
+    if(refresh->full) {
+        // Registers survive powering off, so later refreshes stay partial until a deep sleep
+        return il0323_driver_init_partial(dev);
+    }
+
+    // Bring old data up to date so unchanged pixels of the next area aren't driven again
+    for(int i = 0; i < refresh->count; i++) {
+        const struct il0323_rect *rect = &refresh->rects[i];
+
+        if(il0323_write_rect(driver, 0x10, il0323_buffer, rect)) {
+            return -EIO;
+        }
+
+        for(int row = rect->y0; row < rect->y1; row++) {
+            memcpy(&il0323_last_buffer[row * IL0323_ROW_BYTES + rect->x0],
+                   &il0323_buffer[row * IL0323_ROW_BYTES + rect->x0], rect->x1 - rect->x0);
+        }
+    }
+    driver->ram_valid = true;
 
     // Exit partial mode
     if (il0323_write_reg(driver, 0x92, NULL, 0)) {
         return -EIO;
     }
-    // Check for double refresh
-    if(driver->p_refresh_cnt >= (uint16_t)IL0323_EXTRA_REFRESH_INT) {
-        // Reset last buffer to white, to trigger refresh for black pixels
-        memset(il0323_last_buffer, 0xFF, sizeof(il0323_last_buffer));
-        driver->p_refresh_cnt = 0;
-        // Call refresh
-        return il0323_refresh(dev, x, y, w, h);
+
+    if(refresh->clean) {
+        // Redrawing from white doesn't count towards the next clean
+        refresh->clean = false;
+        driver->ghosting = 0;
+        return 0;
+    }
+
+    // Clean up ghosting with a double refresh once enough pixels have been driven
+    driver->ghosting += refresh->flips;
+    if(driver->ghosting >= (uint32_t)IL0323_GHOSTING_LIMIT) {
+        struct il0323_rect window = refresh->window;
+
+        return il0323_clean_window_start(dev, &window);
     }
-    driver->p_refresh_cnt++;
 
     return 0;
 }
 
+int il0323_clean_start (const struct device *dev, il0323_refresh_cb_t done) {
+    struct il0323_data *driver = dev->data;
+    const struct il0323_rect window = {
+        .x0 = 0, .x1 = IL0323_ROW_BYTES, .y0 = 0, .y1 = EPD_PANEL_HEIGHT};
+
+    if(driver->ghosting < (uint32_t)IL0323_IDLE_CLEAN_LIMIT) {
+        return 0;
+    }
+
+    driver->refresh.done = done;
+
+    return il0323_clean_window_start(dev, &window);
+}
+
+int il0323_refresh (const struct device *dev, int16_t x, int16_t y, int16_t w, int16_t h) {
+    struct il0323_data *driver = dev->data;
+
+    int ret = il0323_refresh_start(dev, x, y, w, h, NULL);
+    while(ret > 0) {
+        // Wait until refreshed
+        il0323_busy_wait(driver);
+        ret = il0323_refresh_finish(dev);
+    }
+
+    return ret;
+}
+
+
+/**
+ * @brief Sets or clears the bits x0 to x1 (exclusive) of a row, MSB first
+ * 
+ * @param row 
+ * @param x0 
+ * @param x1 
+ * @param set 
+ */
+static void il0323_fill_span (uint8_t *row, uint16_t x0, uint16_t x1, bool set) {
+    if(x1 <= x0) {
+        return;
+    }
+
+    uint16_t b0 = x0 / 8;
+    uint16_t b1 = (x1 - 1) / 8;
+    uint8_t m0 = 0xFF >> (x0 % 8);
+    uint8_t m1 = 0xFF << (7 - ((x1 - 1) % 8));
+
+    if(b0 == b1) {
+        m0 &= m1;
+    }
+
+    row[b0] = set ? (row[b0] | m0) : (row[b0] & ~m0);
+    if(b0 == b1) {
+        return;
+    }
+
+    memset(&row[b0 + 1], set ? 0xFF : 0x00, b1 - b0 - 1);
+    row[b1] = set ? (row[b1] | m1) : (row[b1] & ~m1);
+}
+
+/**
+ * @brief Reads 8 bits of a bit row starting at any bit, bits outside the row read as 0
+ * 
+ * @param bits 
+ * @param nbits 
+ * @param pos 
+ * @return uint8_t 
+ */
+static uint8_t il0323_bits_at (const uint8_t *bits, uint16_t nbits, int16_t pos) {
+    if(pos < 0) {
+        return bits[0] >> -pos;
+    }
+
+    uint16_t i = pos / 8;
+    uint8_t shift = pos % 8;
+    uint8_t value = bits[i] << shift;
+    if(shift && i + 1 < (nbits + 7) / 8) {
+        value |= bits[i + 1] >> (8 - shift);
+    }
+    return value;
+}
+
+/**
+ * @brief Draws the set bits of a bit row into a framebuffer row, clipped to the panel
+ * 
+ * @param row 
+ * @param x 
+ * @param bits 
+ * @param nbits 
+ */
+static void il0323_blit_row (uint8_t *row, int16_t x, const uint8_t *bits, uint16_t nbits) {
+    int16_t x0 = MAX(x, 0);
+    int16_t x1 = MIN(x + (int16_t)nbits, (int16_t)EPD_PANEL_WIDTH);
+
+    for(int16_t b = x0 / 8; b * 8 < x1; b++) {
+        uint8_t mask = 0xFF;
+        if(b * 8 < x0) {
+            mask &= 0xFF >> (x0 - b * 8);
+        }
+        if(b * 8 + 8 > x1) {
+            mask &= 0xFF << (b * 8 + 8 - x1);
+        }
+
+        // Set bits are black, which is 0 in the framebuffer
+        row[b] &= ~(il0323_bits_at(bits, nbits, b * 8 - x) & mask);
+    }
+}
+
+void il0323_fill_rect (const struct device *dev, int16_t x, int16_t y, int16_t w, int16_t h, bool black) {
+    int16_t x0 = MAX(x, 0);
+    int16_t y0 = MAX(y, 0);
+    int16_t x1 = MIN(x + w, (int16_t)EPD_PANEL_WIDTH);
+    int16_t y1 = MIN(y + h, (int16_t)EPD_PANEL_HEIGHT);
+
+    if(x1 <= x0) {
+        return;
+    }
+
+    for(int16_t ly = y0; ly < y1; ly++) {
+        il0323_fill_span(&il0323_buffer[ly * IL0323_ROW_BYTES], x0, x1, !black);
+    }
+}
+
+void il0323_blit_rows (const struct device *dev, int16_t x, int16_t y, const uint8_t *rows,
+                       uint16_t stride, uint16_t w, uint16_t h, uint8_t repeat) {
+    for(uint16_t sy = 0; sy < h; sy++) {
+        for(uint8_t r = 0; r < repeat; r++) {
+            int16_t ly = y + sy * repeat + r;
+            if(ly < 0 || ly >= (int16_t)EPD_PANEL_HEIGHT) {
+                continue;
+            }
+            il0323_blit_row(&il0323_buffer[ly * IL0323_ROW_BYTES], x, &rows[sy * stride], w);
+        }
+    }
+}
+
+void il0323_blit (const struct device *dev, int16_t x, int16_t y, const uint8_t *bitmap,
+                  uint16_t stride, uint16_t w, uint16_t h, uint8_t scale) {
+    // Row expanded by scale, wide enough for the whole panel
+    uint8_t expanded[IL0323_ROW_BYTES + 1];
+    uint16_t nbits = MIN(w * scale, sizeof(expanded) * 8);
+
+    if(scale == 0) {
+        return;
+    }
+
+    if(scale == 1) {
+        il0323_blit_rows(dev, x, y, bitmap, stride, w, h, 1);
+        return;
+    }
+
+    for(uint16_t sy = 0; sy < h; sy++) {
+        const uint8_t *src = &bitmap[sy * stride];
+        const uint8_t *bits = src;
+
+        if(scale > 1) {
+            memset(expanded, 0, sizeof(expanded));
+            // Expand runs of set pixels rather than single pixels
+            for(uint16_t px = 0; px < w;) {
+                if(!(src[px / 8] & (0x80 >> (px % 8)))) {
+                    px++;
+                    continue;
+                }
+                uint16_t run = px;
+                while(run < w && (src[run / 8] & (0x80 >> (run % 8)))) {
+                    run++;
+                }
+                il0323_fill_span(expanded, MIN(px * scale, nbits), MIN(run * scale, nbits), true);
+                px = run;
+            }
+            bits = expanded;
+        }
+
+        for(uint8_t r = 0; r < scale; r++) {
+            int16_t ly = y + sy * scale + r;
+            if(ly < 0 || ly >= (int16_t)EPD_PANEL_HEIGHT) {
+                continue;
+            }
+            il0323_blit_row(&il0323_buffer[ly * IL0323_ROW_BYTES], x, bits, scale > 1 ? nbits : w);
+        }
+    }
+}
 
 void il0323_clear_area (const struct device *dev, uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
     struct il0323_data *driver = dev->data;
@@ -486,11 +1087,7 @@ void il0323_clear_area (const struct device *dev, uint8_t x, uint8_t y, uint8_t
     h = (y + h <= EPD_PANEL_HEIGHT) ? h : EPD_PANEL_HEIGHT;
 #endif
 
-    for(int ly = y; ly < y + h; ly++) {
-        for(int lx = x; lx < x + w; lx++) {
-            il0323_buffer[ly * (EPD_PANEL_WIDTH/8) + lx / 8] |= 1 << (7 - (lx % 8));
-        }
-    }
+    il0323_fill_rect(dev, x, y, w, h, false);
 
     return;
 }
@@ -533,9 +1130,7 @@ void il0323_h_line (const struct device *dev, uint8_t x, uint8_t y, uint8_t len)
     if(x >= EPD_PANEL_WIDTH || y >= EPD_PANEL_HEIGHT)
         return;
 #endif
-    for(int i = x; i < x + len; i++) {
-        il0323_buffer[y * (EPD_PANEL_WIDTH/8) + i / 8] &= ~(1 << (7 - (i % 8)));
-    }
+    il0323_fill_span(&il0323_buffer[y * IL0323_ROW_BYTES], x, x + len, false);
 
     return;
 }
@@ -551,13 +1146,123 @@ void il0323_v_line (const struct device *dev, uint8_t x, uint8_t y, uint8_t len)
     if(x >= EPD_PANEL_WIDTH || y >= EPD_PANEL_HEIGHT)
         return;
 #endif
-    for(int i = y; i < y + len; i++) {
-        il0323_buffer[i * (EPD_PANEL_WIDTH/8) + x / 8] &= ~(1 << (7 - (x % 8)));
+    uint8_t *byte = &il0323_buffer[y * IL0323_ROW_BYTES + x / 8];
+    uint8_t mask = ~(0x80 >> (x % 8));
+    for(int i = y; i < y + len; i++, byte += IL0323_ROW_BYTES) {
+        *byte &= mask;
     }
 
     return;
 }
 
+// sin(0..90 degrees) << 14
+static const int16_t il0323_sin_q14[91] = {
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+/**
+ * @brief sin and cos of a whole degree angle, scaled by 1 << 14
+ * 
+ * @param angle 
+ * @param sin 
+ * @param cos 
+ */
+static void il0323_sin_cos (uint16_t angle, int32_t *sin, int32_t *cos) {
+    angle %= 360;
+    uint16_t a = angle % 90;
+    int32_t s = il0323_sin_q14[a];
+    int32_t c = il0323_sin_q14[90 - a];
+
+    switch(angle / 90) {
+    case 0: *sin = s;  *cos = c;  break;
+    case 1: *sin = c;  *cos = -s; break;
+    case 2: *sin = -s; *cos = -c; break;
+    default: *sin = -c; *cos = s; break;
+    }
+}
+
+/**
+ * @brief Whether a point lies within the half turn starting at a direction
+ * 
+ * @param vsin sin of the direction
+ * @param vcos cos of the direction
+ * @param px 
+ * @param py 
+ * @return true if the point's angle is in [direction, direction + 180)
+ */
+static bool il0323_half_turn (int32_t vsin, int32_t vcos, int32_t px, int32_t py) {
+    int32_t cross = vcos * py - vsin * px;
+    return cross > 0 || (cross == 0 && vcos * px + vsin * py > 0);
+}
+
+static inline void il0323_plot (int16_t x, int16_t y) {
+    if(x < 0 || y < 0 || x >= EPD_PANEL_WIDTH || y >= EPD_PANEL_HEIGHT) {
+        return;
+    }
+    il0323_buffer[y * IL0323_ROW_BYTES + x / 8] &= ~(0x80 >> (x % 8));
+}
+
+void il0323_arc (const struct device *dev, int16_t xc, int16_t yc, int16_t radius,
+                 uint16_t start_angle, uint16_t end_angle) {
+    if(end_angle <= start_angle || radius < 0) {
+        return;
+    }
+    if(radius == 0) {
+        il0323_plot(xc, yc);
+        return;
+    }
+
+    uint16_t span = end_angle - start_angle;
+    bool full = span >= 360;
+    int32_t start_sin, start_cos, end_sin, end_cos;
+    il0323_sin_cos(start_angle, &start_sin, &start_cos);
+    il0323_sin_cos(end_angle, &end_sin, &end_cos);
+
+    // Midpoint circle, each step gives one point of all eight octants
+    int16_t x = radius;
+    int16_t y = 0;
+    int16_t err = 1 - radius;
+
+    while(x >= y) {
+        const int16_t points[8][2] = {
+            {x, y}, {y, x}, {-y, x}, {-x, y}, {-x, -y}, {-y, -x}, {y, -x}, {x, -y},
+        };
+
+        for(int i = 0; i < 8; i++) {
+            int32_t px = points[i][0];
+            int32_t py = points[i][1];
+
+            if(!full) {
+                // Angles grow clockwise on screen, as y points down
+                bool after_start = il0323_half_turn(start_sin, start_cos, px, py);
+                bool before_end = !il0323_half_turn(end_sin, end_cos, px, py);
+
+                if(span <= 180 ? !(after_start && before_end) : !(after_start || before_end)) {
+                    continue;
+                }
+            }
+
+            il0323_plot(xc + px, yc + py);
+        }
+
+        y++;
+        if(err < 0) {
+            err += 2 * y + 1;
+        } else {
+            x--;
+            err += 2 * (y - x) + 1;
+        }
+    }
+}
 
 int init_err = 0;
 
@@ -637,6 +1342,12 @@ static int il0323_init (const struct device *dev) {
 
     gpio_pin_configure(driver->busy, IL0323_BUSY_PIN, GPIO_INPUT | IL0323_BUSY_FLAGS);
 
+    gpio_init_callback(&driver->busy_cb, il0323_busy_callback, BIT(IL0323_BUSY_PIN));
+    if (gpio_add_callback(driver->busy, &driver->busy_cb)) {
+        LOG_ERR("Could not set IL0323 busy callback");
+        return -EIO;
+    }
+
 #if defined(IL0323_CS_CNTRL)
     driver->cs_ctrl.gpio_dev = device_get_binding(IL0323_CS_CNTRL);
     if (!driver->cs_ctrl.gpio_dev) {
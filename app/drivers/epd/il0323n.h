@@ -34,7 +34,12 @@ void il0323_set_pixel (const struct device *dev, uint16_t x, uint16_t y);
 void il0323_clear_pixel (const struct device *dev, uint8_t x, uint8_t y);
 
 /**
- * @brief Refreshes an area of the screen
+ * @brief Called from interrupt context when the panel has finished a refresh
+ */
+typedef void (*il0323_refresh_cb_t)(const struct device *dev);
+
+/**
+ * @brief Refreshes an area of the screen, waiting until the panel is done
  * 
  * @param dev 
  * @param x 
@@ -43,7 +48,41 @@ void il0323_clear_pixel (const struct device *dev, uint8_t x, uint8_t y);
  * @param h 
  * @return int 
  */
-int il0323_refresh (struct device *dev, int16_t x, int16_t y, int16_t w, int16_t h);
+int il0323_refresh (const struct device *dev, int16_t x, int16_t y, int16_t w, int16_t h);
+
+/**
+ * @brief Uploads an area of the screen and starts refreshing it without waiting for the panel.
+ * The buffer must not be drawn to until il0323_refresh_finish has returned 0.
+ * 
+ * @param dev 
+ * @param x 
+ * @param y 
+ * @param w 
+ * @param h 
+ * @param done called once the panel is no longer busy
+ * @return int 1 if refreshing, 0 if nothing in the area changed, negative on error
+ */
+int il0323_refresh_start (const struct device *dev, int16_t x, int16_t y, int16_t w, int16_t h,
+                          il0323_refresh_cb_t done);
+
+/**
+ * @brief Completes a refresh after its done callback, from thread context
+ * 
+ * @param dev 
+ * @return int 1 if a clean up refresh was started and done will be called again,
+ * 0 when complete, negative on error
+ */
+int il0323_refresh_finish (const struct device *dev);
+
+/**
+ * @brief Starts a double refresh of the whole panel if enough ghosting has built up, for when
+ * nobody is likely to be looking. Completed like il0323_refresh_start
+ * 
+ * @param dev 
+ * @param done called once the panel is no longer busy
+ * @return int 1 if refreshing, 0 if no clean up is needed, negative on error
+ */
+int il0323_clean_start (const struct device *dev, il0323_refresh_cb_t done);
 
 /**
  * @brief Draws a horizontal line
@@ -65,6 +104,93 @@ void il0323_h_line (const struct device *dev, uint8_t x, uint8_t y, uint8_t len)
  */
 void il0323_v_line (const struct device *dev, uint8_t x, uint8_t y, uint8_t len);
 
+/**
+ * @brief Fills a rectangle with whole bytes where possible, clipped to the panel
+ * 
+ * @param dev 
+ * @param x 
+ * @param y 
+ * @param w 
+ * @param h 
+ * @param black black when true, white otherwise
+ */
+void il0323_fill_rect (const struct device *dev, int16_t x, int16_t y, int16_t w, int16_t h, bool black);
+
+/**
+ * @brief Draws the set pixels of a 1bpp bitmap (MSB first) in black, clipped to the panel
+ * 
+ * @param dev 
+ * @param x 
+ * @param y 
+ * @param bitmap 
+ * @param stride bytes per bitmap row
+ * @param w width in pixels
+ * @param h height in pixels
+ * @param scale integer scaling factor, every pixel becomes scale x scale
+ */
+void il0323_blit (const struct device *dev, int16_t x, int16_t y, const uint8_t *bitmap,
+                  uint16_t stride, uint16_t w, uint16_t h, uint8_t scale);
+
+/**
+ * @brief Draws rows that are already scaled horizontally, repeating each one vertically
+ * 
+ * @param dev 
+ * @param x 
+ * @param y 
+ * @param rows 1bpp rows, MSB first
+ * @param stride bytes per row
+ * @param w width in pixels
+ * @param h number of rows
+ * @param repeat times each row is drawn
+ */
+void il0323_blit_rows (const struct device *dev, int16_t x, int16_t y, const uint8_t *rows,
+                       uint16_t stride, uint16_t w, uint16_t h, uint8_t repeat);
+
+/**
+ * @brief Draws part of a circle, clipped to the panel
+ * 
+ * @param dev 
+ * @param xc 
+ * @param yc 
+ * @param radius 
+ * @param start_angle degrees, clockwise from the positive x axis
+ * @param end_angle degrees, exclusive
+ */
+void il0323_arc (const struct device *dev, int16_t xc, int16_t yc, int16_t radius,
+                 uint16_t start_angle, uint16_t end_angle);
+
+/**
+ * @brief Display activity since boot
+ */
+struct il0323_stats {
+    // Resets out of deep sleep, each followed by register init and a full RAM upload
+    uint32_t wakes;
+    uint32_t power_ons;
+    uint32_t refreshes;
+    uint32_t full_refreshes;
+    // Data bytes sent to the controller
+    uint32_t bytes;
+    // Rough estimate of the energy all of the above took
+    uint32_t energy_uj;
+};
+
+/**
+ * @brief Gets the display activity counters
+ * 
+ * @param dev 
+ * @param stats 
+ */
+void il0323_get_stats (const struct device *dev, struct il0323_stats *stats);
+
+/**
+ * @brief Switches the panel power off, keeping registers and RAM so the next refresh only
+ * needs to power it on again
+ * 
+ * @param dev 
+ * @return int 
+ */
+int il0323_power_off (const struct device *dev);
+
 /**
  * @brief Hibernate display
  * 
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2022 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#define DT_DRV_COMPAT gooddisplay_il0323n
+
+#include "il0323n_emul.h"
+#include <kernel.h>
+#include <device.h>
+#include <string.h>
+
+#include <logging/log.h>
+LOG_MODULE_DECLARE(il0323n, CONFIG_DISPLAY_LOG_LEVEL);
+
+#define EPD_PANEL_WIDTH DT_INST_PROP(0, width)
+#define EPD_PANEL_HEIGHT DT_INST_PROP(0, height)
+
+#define IL0323_EMUL_ROW_BYTES (EPD_PANEL_WIDTH / 8)
+#define IL0323_EMUL_RAM_SIZE (IL0323_EMUL_ROW_BYTES * EPD_PANEL_HEIGHT)
+
+// Busy time of a refresh, roughly what the panel takes with the driver's LUTs
+#define IL0323_EMUL_FULL_REFRESH_MS 1500
+#define IL0323_EMUL_PARTIAL_REFRESH_MS 300
+
+// Byte aligned window, x in bytes and y in rows, end exclusive
+struct il0323_emul_window {
+    uint8_t x0;
+    uint8_t x1;
+    uint8_t y0;
+    uint8_t y1;
+};
+
+static struct {
+    // Command the following data bytes belong to
+    uint8_t cmd;
+    // Data bytes received for the command so far
+    uint16_t param;
+    uint8_t params[5];
+    // Write position in the RAM selected by 0x10/0x13
+    uint8_t *ram;
+    uint8_t x;
+    uint8_t y;
+
+    uint8_t ram_old[IL0323_EMUL_RAM_SIZE];
+    uint8_t ram_new[IL0323_EMUL_RAM_SIZE];
+    // What the panel shows
+    uint8_t panel[IL0323_EMUL_RAM_SIZE];
+
+    bool partial;
+    bool sleeping;
+    struct il0323_emul_window window;
+
+    // Bytes written to RAM since the last refresh
+    uint32_t uploaded;
+    uint32_t refreshes;
+    int64_t busy_until;
+
+    il0323_emul_idle_cb_t idle_cb;
+    void *idle_user_data;
+} emul = {
+    .window = {.x0 = 0, .x1 = IL0323_EMUL_ROW_BYTES, .y0 = 0, .y1 = EPD_PANEL_HEIGHT},
+};
+
+static void il0323_emul_idle_work_callback(struct k_work *work) {
+    il0323_emul_idle_cb_t cb = emul.idle_cb;
+
+    emul.idle_cb = NULL;
+    if(cb != NULL) {
+        cb(emul.idle_user_data);
+    }
+}
+
+static K_WORK_DELAYABLE_DEFINE(il0323_emul_idle_work, il0323_emul_idle_work_callback);
+
+// Logs the panel as a plain PBM image, one line per row, 1 is black
+static void il0323_emul_log_panel (void) {
+    char line[EPD_PANEL_WIDTH + 1];
+
+    LOG_INF("pbm,P1");
+    LOG_INF("pbm,%d %d", EPD_PANEL_WIDTH, EPD_PANEL_HEIGHT);
+    for(int y = 0; y < EPD_PANEL_HEIGHT; y++) {
+        for(int x = 0; x < EPD_PANEL_WIDTH; x++) {
+            uint8_t byte = emul.panel[y * IL0323_EMUL_ROW_BYTES + x / 8];
+            line[x] = (byte & (0x80 >> (x % 8))) ? '0' : '1';
+        }
+        line[EPD_PANEL_WIDTH] = '\0';
+        LOG_INF("pbm,%s", log_strdup(line));
+    }
+}
+
+static void il0323_emul_refresh (void) {
+    struct il0323_emul_window window = emul.window;
+
+    if(!emul.partial) {
+        window = (struct il0323_emul_window){
+            .x0 = 0, .x1 = IL0323_EMUL_ROW_BYTES, .y0 = 0, .y1 = EPD_PANEL_HEIGHT};
+    }
+
+    for(int row = window.y0; row < window.y1; row++) {
+        memcpy(&emul.panel[row * IL0323_EMUL_ROW_BYTES + window.x0],
+               &emul.ram_new[row * IL0323_EMUL_ROW_BYTES + window.x0], window.x1 - window.x0);
+    }
+
+    LOG_INF("refresh,%u,%s,%d,%d,%d,%d,%u", emul.refreshes++, emul.partial ? "partial" : "full",
+            window.x0 * 8, window.y0, (window.x1 - window.x0) * 8, window.y1 - window.y0,
+            emul.uploaded);
+    il0323_emul_log_panel();
+
+    emul.uploaded = 0;
+
+    int32_t duration = emul.partial ? IL0323_EMUL_PARTIAL_REFRESH_MS : IL0323_EMUL_FULL_REFRESH_MS;
+    emul.busy_until = k_uptime_get() + duration;
+    k_work_reschedule(&il0323_emul_idle_work, K_MSEC(duration));
+}
+
+static void il0323_emul_command (uint8_t cmd) {
+    emul.cmd = cmd;
+    emul.param = 0;
+
+    switch(cmd) {
+    case 0x10:
+    case 0x13:
+        // Data fills the partial window, or the whole RAM outside partial mode
+        emul.ram = cmd == 0x10 ? emul.ram_old : emul.ram_new;
+        emul.x = emul.partial ? emul.window.x0 : 0;
+        emul.y = emul.partial ? emul.window.y0 : 0;
+        break;
+    case 0x12:
+        il0323_emul_refresh();
+        break;
+    case 0x91:
+        emul.partial = true;
+        break;
+    case 0x92:
+        emul.partial = false;
+        break;
+    default:
+        break;
+    }
+}
+
+static void il0323_emul_ram_write (uint8_t data) {
+    uint8_t x0 = emul.partial ? emul.window.x0 : 0;
+    uint8_t x1 = emul.partial ? emul.window.x1 : IL0323_EMUL_ROW_BYTES;
+    uint8_t y1 = emul.partial ? emul.window.y1 : EPD_PANEL_HEIGHT;
+
+    // The controller ignores data past the end of the window
+    if(emul.y >= y1) {
+        return;
+    }
+
+    emul.ram[emul.y * IL0323_EMUL_ROW_BYTES + emul.x] = data;
+    emul.uploaded++;
+
+    if(++emul.x >= x1) {
+        emul.x = x0;
+        emul.y++;
+    }
+}
+
+static void il0323_emul_data (uint8_t data) {
+    switch(emul.cmd) {
+    case 0x10:
+    case 0x13:
+        il0323_emul_ram_write(data);
+        break;
+    case 0x90:
+        if(emul.param < sizeof(emul.params)) {
+            emul.params[emul.param] = data;
+        }
+        // Horizontal start and end (inclusive), vertical start and end (inclusive)
+        if(emul.param == 3) {
+            emul.window = (struct il0323_emul_window){
+                .x0 = emul.params[0] / 8,
+                .x1 = MIN(emul.params[1] / 8 + 1, IL0323_EMUL_ROW_BYTES),
+                .y0 = emul.params[2],
+                .y1 = MIN(emul.params[3] + 1, EPD_PANEL_HEIGHT),
+            };
+        }
+        break;
+    case 0x07:
+        if(data == 0xA5) {
+            emul.sleeping = true;
+        }
+        break;
+    default:
+        break;
+    }
+
+    emul.param++;
+}
+
+void il0323_emul_write (bool command, const uint8_t *buf, size_t len) {
+    // Only a reset wakes the controller from deep sleep
+    if(emul.sleeping) {
+        LOG_WRN("Write to the controller in deep sleep");
+        return;
+    }
+
+    if(command) {
+        for(size_t i = 0; i < len; i++) {
+            il0323_emul_command(buf[i]);
+        }
+        return;
+    }
+
+    for(size_t i = 0; i < len; i++) {
+        il0323_emul_data(buf[i]);
+    }
+}
+
+void il0323_emul_reset (void) {
+    // RAM content is undefined after a reset, black makes anything not uploaded again stand out
+    memset(emul.ram_old, 0x00, sizeof(emul.ram_old));
+    memset(emul.ram_new, 0x00, sizeof(emul.ram_new));
+    emul.partial = false;
+    emul.sleeping = false;
+    emul.window = (struct il0323_emul_window){
+        .x0 = 0, .x1 = IL0323_EMUL_ROW_BYTES, .y0 = 0, .y1 = EPD_PANEL_HEIGHT};
+}
+
+bool il0323_emul_busy (void) {
+    return k_uptime_get() < emul.busy_until;
+}
+
+void il0323_emul_on_idle (il0323_emul_idle_cb_t cb, void *user_data) {
+    emul.idle_user_data = user_data;
+    emul.idle_cb = cb;
+}
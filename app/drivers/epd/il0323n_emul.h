@@ -0,0 +1,42 @@
+#ifndef _IL0323N_EMUL_H
+#define _IL0323N_EMUL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Called from the system work queue once the emulated panel is no longer busy
+ */
+typedef void (*il0323_emul_idle_cb_t)(void *user_data);
+
+/**
+ * @brief Feeds bytes to the emulated controller, as if sent over SPI
+ *
+ * @param command true for a command byte (DC low), false for its data
+ * @param buf
+ * @param len
+ */
+void il0323_emul_write (bool command, const uint8_t *buf, size_t len);
+
+/**
+ * @brief Emulates a hardware reset, the controller RAM content is lost
+ */
+void il0323_emul_reset (void);
+
+/**
+ * @brief State of the emulated busy line
+ *
+ * @return true while a refresh is running
+ */
+bool il0323_emul_busy (void);
+
+/**
+ * @brief Sets the callback for the end of the next refresh, NULL to disarm
+ *
+ * @param cb
+ * @param user_data
+ */
+void il0323_emul_on_idle (il0323_emul_idle_cb_t cb, void *user_data);
+
+#endif
@@ -42,10 +42,29 @@ __subsystem struct behavior_driver_api {
     behavior_keymap_binding_callback_t binding_released;
     behavior_sensor_keymap_binding_callback_t sensor_binding_triggered;
 };
+
+struct zmk_behavior_ref {
+    const struct device *device;
+};
 /**
  * @endcond
  */
 
+/**
+ * @brief Like DEVICE_DT_INST_DEFINE, also registers the device in the list of behaviors, which
+ * can be walked with __zmk_behavior_refs_start and __zmk_behavior_refs_end
+ */
+#define BEHAVIOR_DT_INST_DEFINE(inst, ...)                                                         \
+    DEVICE_DT_INST_DEFINE(inst, __VA_ARGS__);                                                      \
+    static const struct zmk_behavior_ref _CONCAT(zmk_behavior_ref_,                                \
+                                                 DEVICE_DT_NAME_GET(DT_DRV_INST(inst)))            \
+        __attribute__((__section__(".zmk_behavior_ref"), used)) = {                                \
+            .device = DEVICE_DT_INST_GET(inst),                                                    \
+    }
+
+extern const struct zmk_behavior_ref __zmk_behavior_refs_start[];
+extern const struct zmk_behavior_ref __zmk_behavior_refs_end[];
+
 /**
  * @brief Handle the keymap binding which needs to be converted from relative "toggle" to absolute
  * "turn on"
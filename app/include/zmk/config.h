@@ -62,6 +62,8 @@ enum zmk_config_key {
 
     // (int32_t[2]) [0] Unix timestamp of time, [1] timezone in seconds
     ZMK_CONFIG_KEY_DATETIME =               0x4000,
+    // (struct zmk_split_link_stats[]) Split link statistics per peripheral, write zeroes to reset
+    ZMK_CONFIG_KEY_SPLIT_LINK_STATS =       0x4001,
 
 
     // --------------------------------------------------------------
@@ -15,10 +15,97 @@
 #include <dt-bindings/zmk/hid_usage.h>
 #include <dt-bindings/zmk/hid_usage_pages.h>
 
+#if IS_ENABLED(CONFIG_ZMK_HID_KEYBOARD_NKRO_EXTENDED_REPORT)
+#define ZMK_HID_KEYBOARD_NKRO_MAX_USAGE HID_USAGE_KEY_KEYBOARD_LANG8
+#else
 #define ZMK_HID_KEYBOARD_NKRO_MAX_USAGE HID_USAGE_KEY_KEYPAD_EQUAL
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_HID_CONSUMER_REPORT_USAGES_BASIC)
+#define ZMK_HID_CONSUMER_MAX_USAGE 0xFF
+#else
+#define ZMK_HID_CONSUMER_MAX_USAGE 0xFFF
+#endif
    
 #define COLLECTION_REPORT 0x03
 
+#define ZMK_HID_MOUSE_COLLECTION                                                                   \
+    /* USAGE_PAGE (Generic Desktop) */                                                             \
+    HID_USAGE_PAGE(HID_USAGE_GD),                                                                  \
+    /* USAGE (Mouse) */                                                                            \
+    HID_USAGE(HID_USAGE_GD_MOUSE),                                                                 \
+    /* COLLECTION (Application) */                                                                 \
+    HID_COLLECTION(HID_COLLECTION_APPLICATION),                                                    \
+        /* REPORT ID (4) */                                                                        \
+        HID_REPORT_ID(0x04),                                                                       \
+        /* USAGE (Pointer) */                                                                      \
+        HID_USAGE(HID_USAGE_GD_POINTER),                                                           \
+        /* COLLECTION (Physical) */                                                                \
+        HID_COLLECTION(HID_COLLECTION_PHYSICAL),                                                   \
+            /* USAGE_PAGE (Button) */                                                              \
+            HID_USAGE_PAGE(HID_USAGE_BUTTON),                                                      \
+            /* USAGE_MINIMUM (0x1) (button 1?) */                                                  \
+            HID_USAGE_MIN8(0x01),                                                                  \
+            /* USAGE_MAXIMUM (0x10) (button 5? Buttons up to 8 still work) */                      \
+            HID_USAGE_MAX8(0x10),                                                                  \
+            /* LOGICAL_MINIMUM (0) */                                                              \
+            HID_LOGICAL_MIN8(0x00),                                                                \
+            /* LOGICAL_MAXIMUM (1) */                                                              \
+            HID_LOGICAL_MAX8(0x01),                                                                \
+            /* REPORT_SIZE (1) */                                                                  \
+            HID_REPORT_SIZE(0x01),                                                                 \
+            /* REPORT_COUNT (16) */                                                                \
+            HID_REPORT_COUNT(0x10),                                                                \
+            /* INPUT (Data,Var,Abs) */                                                             \
+            HID_INPUT(0x02),                                                                       \
+            /* USAGE_PAGE (Generic Desktop) */                                                     \
+            HID_USAGE_PAGE(HID_USAGE_GD),                                                          \
+            /* LOGICAL_MINIMUM (-32767) */                                                         \
+            HID_LOGICAL_MIN16(0x01, 0x80),                                                         \
+            /* LOGICAL_MAXIMUM (32767) */                                                          \
+            HID_LOGICAL_MAX16(0xFF, 0x7F),                                                         \
+            /* REPORT_SIZE (16) */                                                                 \
+            HID_REPORT_SIZE(0x10),                                                                 \
+            /* REPORT_COUNT (2) */                                                                 \
+            HID_REPORT_COUNT(0x02),                                                                \
+            /* USAGE (X) */                                                                        \
+            HID_USAGE(HID_USAGE_GD_X),                                                             \
+            /* USAGE (Y) */                                                                        \
+            HID_USAGE(HID_USAGE_GD_Y),                                                             \
+            /* Input (Data,Var,Rel) */                                                             \
+            HID_INPUT(0x06),                                                                       \
+            /* Vertical scroll */                                                                  \
+            /* LOGICAL_MINIMUM (-127) */                                                           \
+            HID_LOGICAL_MIN8(0x81),                                                                \
+            /* LOGICAL_MAXIMUM (127) */                                                            \
+            HID_LOGICAL_MAX8(0x7F),                                                                \
+            /* REPORT_SIZE (8) */                                                                  \
+            HID_REPORT_SIZE(0x08),                                                                 \
+            /* REPORT_COUNT (1) */                                                                 \
+            HID_REPORT_COUNT(0x01),                                                                \
+            /* USAGE (Wheel) */                                                                    \
+            HID_USAGE(HID_USAGE_GD_WHEEL),                                                         \
+            /* Input (Data,Var,Rel) */                                                             \
+            HID_INPUT(0x06),                                                                       \
+            /* USAGE_PAGE (Consumer) */ /* Horizontal scroll */                                    \
+            HID_USAGE_PAGE(HID_USAGE_CONSUMER),                                                    \
+            /* USAGE (AC Pan) */                                                                   \
+            0x0A,                                                                                  \
+            0x38,                                                                                  \
+            0x02,                                                                                  \
+            /* LOGICAL_MINIMUM (-127) */                                                           \
+            HID_LOGICAL_MIN8(0x81),                                                                \
+            /* LOGICAL_MAXIMUM (127) */                                                            \
+            HID_LOGICAL_MAX8(0x7F),                                                                \
+            /* REPORT_COUNT (1) */                                                                 \
+            HID_REPORT_COUNT(0x01),                                                                \
+            /* Input (Data,Var,Rel) */                                                             \
+            HID_INPUT(0x06),                                                                       \
+        /* END COLLECTION */                                                                       \
+        HID_END_COLLECTION,                                                                        \
+    /* END COLLECTION */                                                                           \
+    HID_END_COLLECTION
+
 static const uint8_t zmk_hid_report_desc[] = {
     HID_USAGE_PAGE(HID_USAGE_GEN_DESKTOP),
     HID_USAGE(HID_USAGE_GD_KEYBOARD),
@@ -94,81 +181,7 @@ static const uint8_t zmk_hid_report_desc[] = {
     /* END COLLECTION */
     HID_END_COLLECTION,
 
-    /* USAGE_PAGE (Generic Desktop) */
-    HID_USAGE_PAGE(HID_USAGE_GD),
-    /* USAGE (Mouse) */
-    HID_USAGE(HID_USAGE_GD_MOUSE),
-    /* COLLECTION (Application) */
-    HID_COLLECTION(HID_COLLECTION_APPLICATION),
-        /* REPORT ID (4) */
-        HID_REPORT_ID(0x04),
-        /* USAGE (Pointer) */
-        HID_USAGE(HID_USAGE_GD_POINTER),
-        /* COLLECTION (Physical) */
-        HID_COLLECTION(HID_COLLECTION_PHYSICAL),
-            /* USAGE_PAGE (Button) */
-            HID_USAGE_PAGE(HID_USAGE_BUTTON),
-            /* USAGE_MINIMUM (0x1) (button 1?) */
-            HID_USAGE_MIN8(0x01),
-            /* USAGE_MAXIMUM (0x10) (button 5? Buttons up to 8 still work) */
-            HID_USAGE_MAX8(0x10),
-            /* LOGICAL_MINIMUM (0) */
-            HID_LOGICAL_MIN8(0x00),
-            /* LOGICAL_MAXIMUM (1) */
-            HID_LOGICAL_MAX8(0x01),
-            /* REPORT_SIZE (1) */
-            HID_REPORT_SIZE(0x01),
-            /* REPORT_COUNT (16) */
-            HID_REPORT_COUNT(0x10),
-            /* INPUT (Data,Var,Abs) */
-            HID_INPUT(0x02),
-            /* USAGE_PAGE (Generic Desktop) */
-            HID_USAGE_PAGE(HID_USAGE_GD),
-            /* LOGICAL_MINIMUM (-32767) */
-            HID_LOGICAL_MIN16(0x01, 0x80),
-            /* LOGICAL_MAXIMUM (32767) */
-            HID_LOGICAL_MAX16(0xFF, 0x7F),
-            /* REPORT_SIZE (16) */
-            HID_REPORT_SIZE(0x10),
-            /* REPORT_COUNT (2) */
-            HID_REPORT_COUNT(0x02),
-            /* USAGE (X) */ 
-            HID_USAGE(HID_USAGE_GD_X),
-            /* USAGE (Y) */
-            HID_USAGE(HID_USAGE_GD_Y),
-            /* Input (Data,Var,Rel) */
-            HID_INPUT(0x06),
-            // Vertical scroll
-            /* LOGICAL_MINIMUM (-127) */
-            HID_LOGICAL_MIN8(0x81),
-            /* LOGICAL_MAXIMUM (127) */
-            HID_LOGICAL_MAX8(0x7F),
-            /* REPORT_SIZE (8) */
-            HID_REPORT_SIZE(0x08),
-            /* REPORT_COUNT (1) */
-            HID_REPORT_COUNT(0x01),
-            /* USAGE (Wheel) */
-            HID_USAGE(HID_USAGE_GD_WHEEL),
-            /* Input (Data,Var,Rel) */
-            HID_INPUT(0x06),
-            /* USAGE_PAGE (Consumer) */ // Horizontal scroll
-            HID_USAGE_PAGE(HID_USAGE_CONSUMER),
-            /* USAGE (AC Pan) */
-            0x0A,
-            0x38,
-            0x02,
-            /* LOGICAL_MINIMUM (-127) */
-            HID_LOGICAL_MIN8(0x81),
-            /* LOGICAL_MAXIMUM (127) */
-            HID_LOGICAL_MAX8(0x7F),
-            /* REPORT_COUNT (1) */
-            HID_REPORT_COUNT(0x01),
-            /* Input (Data,Var,Rel) */
-            HID_INPUT(0x06),
-        /* END COLLECTION */
-        HID_END_COLLECTION,
-    /* END COLLECTION */
-    HID_END_COLLECTION,
+    ZMK_HID_MOUSE_COLLECTION,
 
     // GENERIC COMMUNICATION
     /* USAGE_PAGE (User defined) */
@@ -195,6 +208,13 @@ static const uint8_t zmk_hid_report_desc[] = {
     HID_END_COLLECTION
 };
 
+#if IS_ENABLED(CONFIG_ZMK_USB_HID_MOUSE_INTERFACE)
+// Descriptor of the secondary USB HID interface carrying only mouse/trackpad reports
+static const uint8_t zmk_hid_mouse_report_desc[] = {
+    ZMK_HID_MOUSE_COLLECTION
+};
+#endif
+
 // struct zmk_hid_boot_report
 // {
 //     uint8_t modifiers;
@@ -250,8 +270,8 @@ bool zmk_hid_mod_is_pressed(zmk_mod_t modifier);
 
 int zmk_hid_register_mods(zmk_mod_flags_t explicit_modifiers);
 int zmk_hid_unregister_mods(zmk_mod_flags_t explicit_modifiers);
-int zmk_hid_implicit_modifiers_press(zmk_mod_flags_t implicit_modifiers);
-int zmk_hid_implicit_modifiers_release();
+int zmk_hid_implicit_modifiers_press(uint32_t usage, zmk_mod_flags_t implicit_modifiers);
+int zmk_hid_implicit_modifiers_release(uint32_t usage);
 int zmk_hid_masked_modifiers_set(zmk_mod_flags_t masked_modifiers);
 int zmk_hid_masked_modifiers_clear();
 
@@ -0,0 +1,12 @@
+/*
+ * Copyright (c) 2022 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr.h>
+
+void zmk_hid_benchmark_kscan_event(uint32_t row, uint32_t column, bool pressed);
+int zmk_hid_benchmark_send_report(const uint8_t *report, size_t len);
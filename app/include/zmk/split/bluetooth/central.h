@@ -1,8 +1,28 @@
-
 #pragma once
 
 #include <bluetooth/addr.h>
 #include <zmk/behavior.h>
 
 int zmk_split_bt_invoke_behavior(uint8_t source, struct zmk_behavior_binding *binding,
-                                 struct zmk_behavior_binding_event event, bool state);
\ No newline at end of file
+                                 struct zmk_behavior_binding_event event, bool state);
+
+bool zmk_split_bt_central_is_connected(void);
+
+struct zmk_split_link_stats {
+    uint8_t connected;
+    // Last RSSI reading in dBm, 0 if unknown
+    int8_t rssi;
+    // Position notifications received
+    uint32_t notifications;
+    // Position events missing from the peripheral's sequence numbers
+    uint32_t lost_events;
+    // Position events dropped because the central's queue was full
+    uint32_t dropped_events;
+    // Full position state reads made to recover from lost or dropped events
+    uint32_t resyncs;
+    // Moving average of the time from a key event to its notification arriving, 0 until the
+    // peripheral clock is synchronized
+    uint32_t latency_us;
+} __packed;
+
+int zmk_split_bt_central_get_link_stats(uint8_t index, struct zmk_split_link_stats *stats);
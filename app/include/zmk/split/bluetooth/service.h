@@ -7,6 +7,7 @@
 #pragma once
 
 #include <drivers/sensor.h>
+#include <zmk/trackpad.h>
 
 #define ZMK_SPLIT_RUN_BEHAVIOR_DEV_LEN 9
 
@@ -22,7 +23,85 @@ struct zmk_split_run_behavior_payload {
     char behavior_dev[ZMK_SPLIT_RUN_BEHAVIOR_DEV_LEN];
 } __packed;
 
+/*
+ * Batched behavior invocations, written without response. A write is a version byte followed by
+ * records. Behaviors are identified by a hash of their device label, which both halves compute
+ * from the same devicetree, and params that are zero are left out.
+ */
+#define ZMK_SPLIT_RUN_BEHAVIOR_BATCH_VERSION 1
+
+/*
+ * Status byte read from the batch characteristic. If two of the peripheral's behaviors hash to the
+ * same ID, the central keeps invoking behaviors by label through the run behavior characteristic.
+ */
+#define ZMK_SPLIT_RUN_BEHAVIOR_BATCH_STATUS_IDS_COLLIDE BIT(0)
+
+#define ZMK_SPLIT_RUN_BEHAVIOR_PRESSED BIT(0)
+#define ZMK_SPLIT_RUN_BEHAVIOR_HAS_PARAM1 BIT(1)
+#define ZMK_SPLIT_RUN_BEHAVIOR_HAS_PARAM2 BIT(2)
+
+struct zmk_split_run_behavior_record {
+    uint32_t behavior_id;
+    uint8_t position;
+    uint8_t flags;
+    // Followed by param1 and param2 as little endian 32 bit values when flagged
+} __packed;
+
+#define ZMK_SPLIT_RUN_BEHAVIOR_RECORD_MAX_LEN                                                      \
+    (sizeof(struct zmk_split_run_behavior_record) + 2 * sizeof(uint32_t))
+
+// 32 bit FNV-1a
+static inline uint32_t zmk_split_behavior_id(const char *label) {
+    uint32_t hash = 2166136261U;
+
+    while (*label) {
+        hash ^= (uint8_t)*label++;
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+/*
+ * Position event log notifications. Each notification carries a header followed by `count`
+ * records. Every record consumes one sequence number, so the central can detect lost records and
+ * fall back to reading the position state bitmap.
+ */
+#define ZMK_SPLIT_EVENT_LOG_VERSION 1
+
+#define ZMK_SPLIT_EVENT_LOG_PRESSED BIT(7)
+#define ZMK_SPLIT_EVENT_LOG_POSITION_MASK 0x7F
+
+struct zmk_split_event_log_header {
+    uint8_t version;
+    // Sequence number of the first record
+    uint8_t seq;
+    uint8_t count;
+    // Peripheral uptime of the first record
+    uint32_t timestamp_us;
+} __packed;
+
+struct zmk_split_event_log_record {
+    // Position in the low 7 bits, ZMK_SPLIT_EVENT_LOG_PRESSED when pressed
+    uint8_t position;
+    // Time since the previous record in this notification
+    uint16_t delta_us;
+} __packed;
+
+// Fits a notification into the default 23 byte ATT MTU
+#define ZMK_SPLIT_EVENT_LOG_MAX_RECORDS                                                            \
+    ((23 - 3 - sizeof(struct zmk_split_event_log_header)) /                                        \
+     sizeof(struct zmk_split_event_log_record))
+
+// Trackpad motion notification. Motion is summed on the peripheral until it can be notified.
+struct zmk_split_motion_data {
+    int16_t dx;
+    int16_t dy;
+    uint8_t finger_count;
+    uint16_t gestures;
+} __packed;
 
 int zmk_split_bt_position_pressed(uint8_t position);
 int zmk_split_bt_position_released(uint8_t position);
 int zmk_split_bt_sensor_triggered(uint8_t sensor_number, struct sensor_value value);
+int zmk_split_bt_trackpad_report(const struct zmk_trackpad_data *data);
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2022 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zmk/behavior.h>
+
+// Transport independent interface of the split central
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE)
+#include <zmk/ble.h>
+#define ZMK_SPLIT_PERIPHERAL_COUNT ZMK_BLE_SPLIT_PERIPHERAL_COUNT
+#else
+#define ZMK_SPLIT_PERIPHERAL_COUNT 1
+#endif
+
+int zmk_split_central_invoke_behavior(uint8_t source, struct zmk_behavior_binding *binding,
+                                      struct zmk_behavior_binding_event event, bool state);
+
+bool zmk_split_central_is_connected(void);
@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) 2022 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zmk/trackpad.h>
+
+// Transport independent interface of a split peripheral
+
+bool zmk_split_peripheral_is_connected(void);
+
+int zmk_split_peripheral_trackpad_report(const struct zmk_trackpad_data *data);
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2022 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr/types.h>
+#include <drivers/sensor.h>
+
+/*
+ * Frames are COBS encoded and end with a zero byte, so a receiver that starts listening mid frame
+ * or sees line noise resynchronizes at the next delimiter. A decoded frame is a message type, the
+ * message body and a CRC-8 over both.
+ */
+#define ZMK_SPLIT_WIRED_FRAME_DELIMITER 0x00
+
+// Largest message body, excluding the type and CRC bytes
+#define ZMK_SPLIT_WIRED_MAX_MSG_LEN 32
+
+// COBS adds one byte per 254, plus the type, CRC and delimiter bytes
+#define ZMK_SPLIT_WIRED_MAX_FRAME_LEN (ZMK_SPLIT_WIRED_MAX_MSG_LEN + 5)
+
+enum zmk_split_wired_msg_type {
+    // Central to peripheral, empty. Sent when nothing else was sent for a heartbeat interval.
+    // The peripheral resends its position state every interval instead.
+    ZMK_SPLIT_WIRED_MSG_HEARTBEAT = 0x01,
+    // Peripheral to central, the full position state bitmap
+    ZMK_SPLIT_WIRED_MSG_POSITION_STATE = 0x02,
+    // Peripheral to central, struct zmk_split_wired_sensor_event
+    ZMK_SPLIT_WIRED_MSG_SENSOR_EVENT = 0x03,
+    // Peripheral to central, struct zmk_split_motion_data
+    ZMK_SPLIT_WIRED_MSG_MOTION = 0x04,
+    // Central to peripheral, struct zmk_split_run_behavior_payload
+    ZMK_SPLIT_WIRED_MSG_RUN_BEHAVIOR = 0x05,
+};
+
+#define ZMK_SPLIT_WIRED_POSITION_STATE_LEN 16
+
+struct zmk_split_wired_sensor_event {
+    uint8_t sensor_number;
+    int32_t val1;
+    int32_t val2;
+} __packed;
+
+typedef void (*zmk_split_wired_msg_handler_t)(uint8_t type, const uint8_t *data, size_t len);
+
+int zmk_split_wired_init(zmk_split_wired_msg_handler_t handler);
+int zmk_split_wired_send(uint8_t type, const void *data, size_t len);
+
+// Milliseconds since the last valid frame was received, or -1 if none has been
+int64_t zmk_split_wired_last_rx_age(void);
+
+// Milliseconds since the last frame was sent, or -1 if none has been
+int64_t zmk_split_wired_last_tx_age(void);
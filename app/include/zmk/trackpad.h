@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2022 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr.h>
+
+// Gesture bits follow the IQS5xx gesture event registers: gestures0 in the low byte, gestures1 in
+// the high byte.
+#define ZMK_TRACKPAD_GESTURE_SINGLE_TAP BIT(0)
+#define ZMK_TRACKPAD_GESTURE_TAP_AND_HOLD BIT(1)
+#define ZMK_TRACKPAD_GESTURE_TWO_FINGER_TAP BIT(8)
+#define ZMK_TRACKPAD_GESTURE_SCROLL BIT(9)
+
+#define ZMK_TRACKPAD_GESTURES(gestures0, gestures1) ((gestures0) | ((uint16_t)(gestures1) << 8))
+
+struct zmk_trackpad_data {
+    // Relative motion in sensor axes
+    int16_t dx;
+    int16_t dy;
+    uint8_t finger_count;
+    uint16_t gestures;
+};
+
+// Turns trackpad motion and gestures into mouse reports, whichever half the trackpad is on
+void zmk_trackpad_process(const struct zmk_trackpad_data *data);
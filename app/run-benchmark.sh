@@ -0,0 +1,72 @@
+#!/bin/sh
+
+# Copyright (c) 2022 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+
+# Builds a benchmark keymap with CONFIG_ZMK_HID_BENCHMARK, replays its kscan mock events and
+# writes per-report latencies to build/<case>/latency.csv plus one summary line per case to
+# build/benchmarks/summary.csv. Times are in native_posix simulated microseconds, so they
+# measure scheduling and behavior delays (tapping terms, combo timeouts, macro waits), not CPU time.
+
+if [ -z "$1" ]; then
+	echo "Usage: ./run-benchmark.sh <path to benchmark case>"
+	exit 1
+fi
+
+path="$1"
+if [ $path = "all" ]; then
+	path="benchmarks"
+fi
+
+summary=./build/benchmarks/summary.csv
+
+benchmarks=$(find $path -name native_posix_64.keymap -exec dirname \{\} \;)
+num_cases=$(echo "$benchmarks" | wc -l)
+if [ $num_cases -gt 1 ] || [ "$benchmarks" != "$path" ]; then
+	mkdir -p ./build/benchmarks
+	echo "case,kscan_events,reports,latency_min_us,latency_avg_us,latency_max_us,duration_us,reports_per_s" > $summary
+	echo "$benchmarks" | xargs -L 1 -P ${J:-4} ./run-benchmark.sh
+	err=$?
+	cat $summary
+	exit $err
+fi
+
+benchmark="$path"
+echo "Running $benchmark:"
+
+west build -d build/$benchmark -b native_posix_64 -- -DZMK_CONFIG="$(pwd)/$benchmark" > /dev/null 2>&1
+if [ $? -gt 0 ]; then
+	echo "FAILED: $benchmark did not build"
+	exit 1
+fi
+
+./build/$benchmark/zephyr/zmk.exe | sed -n -e "s/.*bench,//p" > build/$benchmark/bench.log
+
+# Each report is attributed to the most recent key scan event before it.
+awk -F, -v name="$benchmark" -v latency="build/$benchmark/latency.csv" -v summary="$summary" '
+BEGIN { print "report_seq,report_id,kscan_seq,latency_us" > latency }
+$1 == "kscan" {
+	kscans++; kscan_seq = $2; kscan_t = $3
+	if (first_t == "") { first_t = $3 }
+}
+$1 == "report" && kscan_seq != "" {
+	l = $3 - kscan_t
+	print $2 "," $4 "," kscan_seq "," l > latency
+	reports++; sum += l; last_t = $3
+	if (min == "" || l < min) { min = l }
+	if (max == "" || l > max) { max = l }
+}
+END {
+	if (reports == 0) { print "No reports recorded"; exit 1 }
+	duration = last_t - first_t
+	line = sprintf("%s,%d,%d,%d,%d,%d,%d,%.1f", name, kscans, reports, min, sum / reports, max,
+		duration, duration > 0 ? reports * 1000000 / duration : 0)
+	print line
+	if (summary != "" && system("test -f " summary) == 0) { print line >> summary }
+}' build/$benchmark/bench.log
+if [ $? -gt 0 ]; then
+	echo "FAILED: $benchmark"
+	exit 1
+fi
+
+exit 0
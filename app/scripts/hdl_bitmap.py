@@ -0,0 +1,98 @@
+# Copyright (c) 2022 The ZMK Contributors
+# SPDX-License-Identifier: MIT
+"""Convert a monochrome BMP into an HDL preloadable bitmap C source.
+
+The output image is 1 bit per pixel, rows top to bottom and packed MSb
+first without padding, behind an 11 byte little endian header:
+
+    u16 reserved, u16 data size, u16 width, u16 height,
+    u8 sprite width, u8 sprite height, u8 bits per pixel
+
+A set bit is white and a clear bit black, same as the e-paper framebuffer.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+
+def read_bmp(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data[:2] != b"BM":
+        sys.exit(f"{path}: not a BMP file")
+
+    (offset,) = struct.unpack_from("<I", data, 10)
+    (width, height, planes, bpp, compression) = struct.unpack_from("<iiHHI", data, 18)
+    if bpp != 1 or compression != 0:
+        sys.exit(f"{path}: expected an uncompressed 1 bit image, got {bpp} bpp")
+
+    # The palette follows the info header, 4 bytes per color
+    (header_size,) = struct.unpack_from("<I", data, 14)
+    palette = data[14 + header_size : 14 + header_size + 8]
+    invert = sum(palette[0:3]) > sum(palette[4:7])
+
+    row_bytes = (width + 7) // 8
+    stride = ((width + 31) // 32) * 4
+    rows = []
+    for y in range(abs(height)):
+        row = bytearray(data[offset + y * stride : offset + y * stride + row_bytes])
+        if invert:
+            row = bytearray(b ^ 0xFF for b in row)
+        # Pixels past the width are white
+        if width % 8:
+            row[-1] |= 0xFF >> (width % 8)
+        rows.append(bytes(row))
+
+    # Positive height means the rows are stored bottom up
+    if height > 0:
+        rows.reverse()
+
+    return width, abs(height), b"".join(rows)
+
+
+def c_name(path):
+    name = re.sub(r"^.*[/\\]", "", path)
+    return re.sub(r"[^0-9A-Za-z]", "_", name) + "_c"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="1 bit BMP image")
+    parser.add_argument("output", help="C source to write")
+    parser.add_argument("--sprite-width", type=int, default=0)
+    parser.add_argument("--sprite-height", type=int, default=0)
+    args = parser.parse_args()
+
+    width, height, pixels = read_bmp(args.input)
+    sprite_width = args.sprite_width or width
+    sprite_height = args.sprite_height or height
+
+    if width % sprite_width or height % sprite_height or max(sprite_width, sprite_height) > 0xFF:
+        sys.exit(f"{args.input}: {width}x{height} can't be split into "
+                 f"{sprite_width}x{sprite_height} sprites")
+
+    image = struct.pack("<HHHHBBB", 0, len(pixels), width, height, sprite_width,
+                        sprite_height, 1) + pixels
+    name = c_name(args.input)
+
+    lines = [
+        f"// Filename: {name}",
+        f"// Width: {width} Height: {height} "
+        f"Sprite width: {sprite_width} Sprite height: {sprite_height}",
+        "// Generated from the BMP at build time, do not edit",
+        f"const unsigned long HDL_IMG_SIZE_{name} = {len(image)};",
+        f"const unsigned char HDL_IMG_{name}[] = {{",
+    ]
+    for i in range(0, len(image), 16):
+        lines.append(" ".join(f"0x{b:02X}," for b in image[i : i + 16]))
+    lines.append("};")
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
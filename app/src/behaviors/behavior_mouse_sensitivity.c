@@ -92,9 +92,10 @@ struct mouse_config_sens {
         .delay_ms = DT_INST_PROP(n, delay_ms)                                               \
     };                                                                                      \
                                                                                             \
-    DEVICE_DT_INST_DEFINE(n, behavior_mouse_sensitivity_init, NULL, NULL,                   \
-                          &behavior_mouse_scroll_config_##n, APPLICATION,                                                \
-                          CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &behavior_mouse_sensitivity_driver_api);
+    BEHAVIOR_DT_INST_DEFINE(n, behavior_mouse_sensitivity_init, NULL, NULL,                        \
+                            &behavior_mouse_scroll_config_##n, APPLICATION,                        \
+                            CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,                                   \
+                            &behavior_mouse_sensitivity_driver_api);
 
 DT_INST_FOREACH_STATUS_OKAY(KP_INST)
 
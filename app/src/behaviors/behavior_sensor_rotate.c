@@ -71,7 +71,7 @@ static int behavior_sensor_rotate_init(const struct device *dev) { return 0; };
         .ccw_binding = _TRANSFORM_ENTRY(1, n),                                                     \
         .tap_ms = DT_INST_PROP_OR(n, tap_ms, 5),                                                   \
     };                                                                                             \
-    DEVICE_DT_INST_DEFINE(                                                                         \
+    BEHAVIOR_DT_INST_DEFINE(                                                                       \
         n, behavior_sensor_rotate_init, NULL, NULL, &behavior_sensor_rotate_config_##n,            \
         APPLICATION, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &behavior_sensor_rotate_driver_api);
 
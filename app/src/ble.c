@@ -36,6 +36,10 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/event_manager.h>
 #include <zmk/events/ble_active_profile_changed.h>
 
+#if IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION)
+#include <zmk/events/activity_state_changed.h>
+#endif
+
 #if IS_ENABLED(CONFIG_ZMK_BLE_PASSKEY_ENTRY)
 #include <zmk/events/keycode_state_changed.h>
 
@@ -57,6 +61,8 @@ enum advertising_type {
     ZMK_ADV_NONE,
     ZMK_ADV_DIR,
     ZMK_ADV_CONN,
+    ZMK_ADV_WARM,
+    ZMK_ADV_WARM_SLOW,
 } advertising_status;
 
 #define CURR_ADV(adv) (adv << 4)
@@ -65,6 +71,18 @@ enum advertising_type {
     BT_LE_ADV_PARAM(BT_LE_ADV_OPT_CONNECTABLE | BT_LE_ADV_OPT_ONE_TIME, BT_GAP_ADV_FAST_INT_MIN_2, \
                     BT_GAP_ADV_FAST_INT_MAX_2, NULL)
 
+// Keep-warm advertising only accepts connections and scan requests from the filter accept list
+#define ZMK_ADV_WARM_OPTIONS                                                                       \
+    (BT_LE_ADV_OPT_CONNECTABLE | BT_LE_ADV_OPT_ONE_TIME | BT_LE_ADV_OPT_FILTER_CONN |             \
+     BT_LE_ADV_OPT_FILTER_SCAN_REQ)
+
+#define ZMK_ADV_WARM_NAME                                                                          \
+    BT_LE_ADV_PARAM(ZMK_ADV_WARM_OPTIONS, BT_GAP_ADV_FAST_INT_MIN_2, BT_GAP_ADV_FAST_INT_MAX_2,    \
+                    NULL)
+
+#define ZMK_ADV_WARM_NAME_SLOW                                                                     \
+    BT_LE_ADV_PARAM(ZMK_ADV_WARM_OPTIONS, BT_GAP_ADV_SLOW_INT_MIN, BT_GAP_ADV_SLOW_INT_MAX, NULL)
+
 static struct zmk_ble_profile profiles[ZMK_BLE_PROFILE_COUNT];
 static uint8_t active_profile;
 
@@ -82,12 +100,42 @@ static const struct bt_data zmk_ble_ad[] = {
                   ),
 };
 
+// Not discoverable, so hosts that aren't bonded don't list the keyboard while it keeps others warm
+static const struct bt_data zmk_ble_warm_ad[] = {
+    BT_DATA_BYTES(BT_DATA_FLAGS, BT_LE_AD_NO_BREDR),
+    BT_DATA_BYTES(BT_DATA_UUID16_SOME, 0x12, 0x18, /* HID Service */
+                  0x0f, 0x18                       /* Battery Service */
+                  ),
+};
+
 #if IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
 
 static bt_addr_le_t peripheral_addr;
 
 #endif /* IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL) */
 
+#if IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION)
+
+#define ZMK_BLE_ACTIVE_CONN_PARAM                                                                  \
+    BT_LE_CONN_PARAM(CONFIG_BT_PERIPHERAL_PREF_MIN_INT, CONFIG_BT_PERIPHERAL_PREF_MAX_INT,         \
+                     CONFIG_BT_PERIPHERAL_PREF_LATENCY, CONFIG_BT_PERIPHERAL_PREF_TIMEOUT)
+
+#define ZMK_BLE_IDLE_CONN_PARAM                                                                    \
+    BT_LE_CONN_PARAM(CONFIG_ZMK_BLE_IDLE_CONN_INTERVAL, CONFIG_ZMK_BLE_IDLE_CONN_INTERVAL,         \
+                     CONFIG_ZMK_BLE_IDLE_CONN_LATENCY, CONFIG_ZMK_BLE_IDLE_CONN_TIMEOUT)
+
+// Advertising for bonded hosts of inactive profiles is bounded: a fast window, then slow
+// advertising, then nothing until the next profile switch or activity.
+enum keep_warm_phase {
+    KEEP_WARM_FAST,
+    KEEP_WARM_SLOW,
+    KEEP_WARM_DONE,
+};
+
+static enum keep_warm_phase keep_warm_phase;
+
+#endif /* IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION) */
+
 static void raise_profile_changed_event() {
     ZMK_EVENT_RAISE(new_zmk_ble_active_profile_changed((struct zmk_ble_active_profile_changed){
         .index = active_profile, .profile = &profiles[active_profile]}));
@@ -130,6 +178,99 @@ bool zmk_ble_active_profile_is_connected() {
     return true;
 }
 
+#if IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION)
+
+static int profile_index_for_addr(const bt_addr_le_t *addr) {
+    for (int i = 0; i < ZMK_BLE_PROFILE_COUNT; i++) {
+        if (bt_addr_le_cmp(&profiles[i].peer, BT_ADDR_LE_ANY) &&
+            !bt_addr_le_cmp(&profiles[i].peer, addr)) {
+            return i;
+        }
+    }
+    return -ENODEV;
+}
+
+static bool all_bonded_profiles_connected() {
+    for (int i = 0; i < ZMK_BLE_PROFILE_COUNT; i++) {
+        if (!bt_addr_le_cmp(&profiles[i].peer, BT_ADDR_LE_ANY)) {
+            continue;
+        }
+
+        struct bt_conn *conn = bt_conn_lookup_addr_le(BT_ID_DEFAULT, &profiles[i].peer);
+        if (conn == NULL) {
+            return false;
+        }
+        bt_conn_unref(conn);
+    }
+    return true;
+}
+
+// Inactive hosts are kept connected on a long interval with slave latency, so switching to them
+// only needs a parameter update instead of a full reconnect.
+static void update_conn_param(struct bt_conn *conn, bool active) {
+    int err = bt_conn_le_param_update(conn, active ? ZMK_BLE_ACTIVE_CONN_PARAM
+                                                   : ZMK_BLE_IDLE_CONN_PARAM);
+    if (err) {
+        LOG_WRN("Failed to update connection parameters (err %d)", err);
+    }
+}
+
+static void update_profile_conn_param(uint8_t index, bool active) {
+    if (!bt_addr_le_cmp(&profiles[index].peer, BT_ADDR_LE_ANY)) {
+        return;
+    }
+
+    struct bt_conn *conn = bt_conn_lookup_addr_le(BT_ID_DEFAULT, &profiles[index].peer);
+    if (conn == NULL) {
+        return;
+    }
+
+    LOG_DBG("Profile %d connection set to %s parameters", index, active ? "active" : "idle");
+    update_conn_param(conn, active);
+    bt_conn_unref(conn);
+}
+
+// Fills the filter accept list with the bonded hosts that aren't connected. Advertising with the
+// list must be stopped while it changes.
+static int update_keep_warm_accept_list() {
+    int err = bt_le_filter_accept_list_clear();
+    if (err) {
+        return err;
+    }
+
+    for (int i = 0; i < ZMK_BLE_PROFILE_COUNT; i++) {
+        if (i == active_profile || !bt_addr_le_cmp(&profiles[i].peer, BT_ADDR_LE_ANY)) {
+            continue;
+        }
+
+        struct bt_conn *conn = bt_conn_lookup_addr_le(BT_ID_DEFAULT, &profiles[i].peer);
+        if (conn != NULL) {
+            bt_conn_unref(conn);
+            continue;
+        }
+
+        err = bt_le_filter_accept_list_add(&profiles[i].peer);
+        if (err) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+
+static void keep_warm_timeout_callback(struct k_work *work);
+
+K_WORK_DELAYABLE_DEFINE(keep_warm_timeout_work, keep_warm_timeout_callback);
+
+static void restart_keep_warm_advertising() {
+    LOG_DBG("Restarting advertising window for inactive profiles");
+    keep_warm_phase = KEEP_WARM_FAST;
+    k_work_reschedule(&keep_warm_timeout_work,
+                      K_SECONDS(CONFIG_ZMK_BLE_MULTI_CONNECTION_FAST_ADV_DURATION));
+}
+
+#endif /* IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION) */
+
 #define CHECKED_ADV_STOP()                                                                         \
     err = bt_le_adv_stop();                                                                        \
     advertising_status = ZMK_ADV_NONE;                                                             \
@@ -162,6 +303,19 @@ bool zmk_ble_active_profile_is_connected() {
     }                                                                                              \
     advertising_status = ZMK_ADV_CONN;
 
+#define CHECKED_WARM_ADV(param, status)                                                            \
+    err = update_keep_warm_accept_list();                                                          \
+    if (err) {                                                                                     \
+        LOG_ERR("Failed to update the filter accept list (err %d)", err);                          \
+        return err;                                                                                \
+    }                                                                                              \
+    err = bt_le_adv_start(param, zmk_ble_warm_ad, ARRAY_SIZE(zmk_ble_warm_ad), NULL, 0);           \
+    if (err) {                                                                                     \
+        LOG_ERR("Advertising failed to start (err %d)", err);                                      \
+        return err;                                                                                \
+    }                                                                                              \
+    advertising_status = status;
+
 int update_advertising() {
     int err = 0;
     bt_addr_le_t *addr;
@@ -180,15 +334,25 @@ int update_advertising() {
         // LOG_DBG("Directed advertising to %s", log_strdup(addr_str));
         // desired_adv = ZMK_ADV_DIR;
     }
+#if IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION)
+    else if (keep_warm_phase != KEEP_WARM_DONE && !all_bonded_profiles_connected()) {
+        // Let the other bonded hosts reconnect so they stay warm for a profile switch
+        desired_adv = keep_warm_phase == KEEP_WARM_FAST ? ZMK_ADV_WARM : ZMK_ADV_WARM_SLOW;
+    }
+#endif
     LOG_DBG("advertising from %d to %d", advertising_status, desired_adv);
 
     switch (desired_adv + CURR_ADV(advertising_status)) {
     case ZMK_ADV_NONE + CURR_ADV(ZMK_ADV_DIR):
     case ZMK_ADV_NONE + CURR_ADV(ZMK_ADV_CONN):
+    case ZMK_ADV_NONE + CURR_ADV(ZMK_ADV_WARM):
+    case ZMK_ADV_NONE + CURR_ADV(ZMK_ADV_WARM_SLOW):
         CHECKED_ADV_STOP();
         break;
     case ZMK_ADV_DIR + CURR_ADV(ZMK_ADV_DIR):
     case ZMK_ADV_DIR + CURR_ADV(ZMK_ADV_CONN):
+    case ZMK_ADV_DIR + CURR_ADV(ZMK_ADV_WARM):
+    case ZMK_ADV_DIR + CURR_ADV(ZMK_ADV_WARM_SLOW):
         CHECKED_ADV_STOP();
         CHECKED_DIR_ADV();
         break;
@@ -196,12 +360,34 @@ int update_advertising() {
         CHECKED_DIR_ADV();
         break;
     case ZMK_ADV_CONN + CURR_ADV(ZMK_ADV_DIR):
+    case ZMK_ADV_CONN + CURR_ADV(ZMK_ADV_WARM):
+    case ZMK_ADV_CONN + CURR_ADV(ZMK_ADV_WARM_SLOW):
         CHECKED_ADV_STOP();
         CHECKED_OPEN_ADV();
         break;
     case ZMK_ADV_CONN + CURR_ADV(ZMK_ADV_NONE):
         CHECKED_OPEN_ADV();
         break;
+#if IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION)
+    case ZMK_ADV_WARM + CURR_ADV(ZMK_ADV_DIR):
+    case ZMK_ADV_WARM + CURR_ADV(ZMK_ADV_CONN):
+    case ZMK_ADV_WARM + CURR_ADV(ZMK_ADV_WARM_SLOW):
+        CHECKED_ADV_STOP();
+        CHECKED_WARM_ADV(ZMK_ADV_WARM_NAME, ZMK_ADV_WARM);
+        break;
+    case ZMK_ADV_WARM + CURR_ADV(ZMK_ADV_NONE):
+        CHECKED_WARM_ADV(ZMK_ADV_WARM_NAME, ZMK_ADV_WARM);
+        break;
+    case ZMK_ADV_WARM_SLOW + CURR_ADV(ZMK_ADV_DIR):
+    case ZMK_ADV_WARM_SLOW + CURR_ADV(ZMK_ADV_CONN):
+    case ZMK_ADV_WARM_SLOW + CURR_ADV(ZMK_ADV_WARM):
+        CHECKED_ADV_STOP();
+        CHECKED_WARM_ADV(ZMK_ADV_WARM_NAME_SLOW, ZMK_ADV_WARM_SLOW);
+        break;
+    case ZMK_ADV_WARM_SLOW + CURR_ADV(ZMK_ADV_NONE):
+        CHECKED_WARM_ADV(ZMK_ADV_WARM_NAME_SLOW, ZMK_ADV_WARM_SLOW);
+        break;
+#endif /* IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION) */
     }
 
     return 0;
@@ -211,6 +397,24 @@ static void update_advertising_callback(struct k_work *work) { update_advertisin
 
 K_WORK_DEFINE(update_advertising_work, update_advertising_callback);
 
+#if IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION)
+
+static void keep_warm_timeout_callback(struct k_work *work) {
+    if (keep_warm_phase == KEEP_WARM_FAST) {
+        LOG_DBG("Slowing down advertising for inactive profiles");
+        keep_warm_phase = KEEP_WARM_SLOW;
+        k_work_reschedule(&keep_warm_timeout_work,
+                          K_SECONDS(CONFIG_ZMK_BLE_MULTI_CONNECTION_SLOW_ADV_DURATION));
+    } else {
+        LOG_DBG("Stopping advertising for inactive profiles");
+        keep_warm_phase = KEEP_WARM_DONE;
+    }
+
+    update_advertising();
+}
+
+#endif /* IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION) */
+
 int zmk_ble_clear_bonds() {
     LOG_DBG("");
 
@@ -253,6 +457,12 @@ int zmk_ble_prof_select(uint8_t index) {
         return 0;
     }
 
+#if IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION)
+    update_profile_conn_param(active_profile, false);
+    update_profile_conn_param(index, true);
+    restart_keep_warm_advertising();
+#endif
+
     active_profile = index;
     ble_save_profile();
 
@@ -393,6 +603,12 @@ static void connected(struct bt_conn *conn, uint8_t err) {
         LOG_DBG("Active profile connected");
         k_work_submit(&raise_profile_changed_event_work);
     }
+#if IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION)
+    else if (profile_index_for_addr(bt_conn_get_dst(conn)) >= 0) {
+        LOG_DBG("Inactive profile connected, relaxing connection parameters");
+        update_conn_param(conn, false);
+    }
+#endif
 }
 
 static void disconnected(struct bt_conn *conn, uint8_t reason) {
@@ -590,6 +806,10 @@ static int zmk_ble_init(const struct device *_arg) {
     bt_conn_cb_register(&conn_callbacks);
     bt_conn_auth_cb_register(&zmk_ble_auth_cb_display);
 
+#if IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION)
+    restart_keep_warm_advertising();
+#endif
+
     zmk_ble_ready(0);
 
     return 0;
@@ -670,4 +890,21 @@ ZMK_LISTENER(zmk_ble, zmk_ble_listener);
 ZMK_SUBSCRIPTION(zmk_ble, zmk_keycode_state_changed);
 #endif /* IS_ENABLED(CONFIG_ZMK_BLE_PASSKEY_ENTRY) */
 
+#if IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION)
+
+static int zmk_ble_multi_conn_listener(const zmk_event_t *eh) {
+    const struct zmk_activity_state_changed *ev = as_zmk_activity_state_changed(eh);
+
+    if (ev != NULL && ev->state == ZMK_ACTIVITY_ACTIVE) {
+        restart_keep_warm_advertising();
+        k_work_submit(&update_advertising_work);
+    }
+
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(zmk_ble_multi_conn, zmk_ble_multi_conn_listener);
+ZMK_SUBSCRIPTION(zmk_ble_multi_conn, zmk_activity_state_changed);
+#endif /* IS_ENABLED(CONFIG_ZMK_BLE_MULTI_CONNECTION) */
+
 SYS_INIT(zmk_ble_init, APPLICATION, CONFIG_ZMK_BLE_INIT_PRIORITY);
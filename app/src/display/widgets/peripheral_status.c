@@ -13,7 +13,7 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/display.h>
 #include <zmk/display/widgets/peripheral_status.h>
 #include <zmk/event_manager.h>
-#include <zmk/split/bluetooth/peripheral.h>
+#include <zmk/split/peripheral.h>
 #include <zmk/events/split_peripheral_status_changed.h>
 
 static sys_slist_t widgets = SYS_SLIST_STATIC_INIT(&widgets);
@@ -23,7 +23,7 @@ struct peripheral_status_state {
 };
 
 static struct peripheral_status_state get_state(const zmk_event_t *_eh) {
-    return (struct peripheral_status_state){.connected = zmk_split_bt_peripheral_is_connected()};
+    return (struct peripheral_status_state){.connected = zmk_split_peripheral_is_connected()};
 }
 
 static void set_status_symbol(lv_obj_t *label, struct peripheral_status_state state) {
@@ -13,6 +13,7 @@
 #include <dt-bindings/zmk/hid_usage_pages.h>
 #include <zmk/usb_hid.h>
 #include <zmk/hog.h>
+#include <zmk/hid_benchmark.h>
 #include <zmk/event_manager.h>
 #include <zmk/events/ble_active_profile_changed.h>
 #include <zmk/events/usb_conn_state_changed.h>
@@ -29,6 +30,8 @@ static enum zmk_endpoint preferred_endpoint =
     ZMK_ENDPOINT_USB; /* Used if multiple endpoints are ready */
 
 static void update_current_endpoint();
+static int send_keyboard_report_to_endpoint(struct zmk_hid_keyboard_report *keyboard_report);
+static int send_consumer_report_to_endpoint(struct zmk_hid_consumer_report *consumer_report);
 
 #if IS_ENABLED(CONFIG_SETTINGS)
 static void endpoints_save_preferred_work(struct k_work *work) {
@@ -70,9 +73,58 @@ int zmk_endpoints_toggle() {
     return zmk_endpoints_select(new_endpoint);
 }
 
+// Copies of the last reports successfully handed to the current endpoint. Identical reports are
+// suppressed, since they only cost USB/BLE airtime without changing the host state.
+static struct zmk_hid_keyboard_report last_keyboard_report;
+static struct zmk_hid_consumer_report last_consumer_report;
+static bool last_keyboard_report_valid = false;
+static bool last_consumer_report_valid = false;
+
+static void invalidate_last_reports() {
+    last_keyboard_report_valid = false;
+    last_consumer_report_valid = false;
+}
+
 static int send_keyboard_report() {
     struct zmk_hid_keyboard_report *keyboard_report = zmk_hid_get_keyboard_report();
 
+    if (last_keyboard_report_valid &&
+        memcmp(&last_keyboard_report, keyboard_report, sizeof(*keyboard_report)) == 0) {
+        LOG_DBG("Keyboard report unchanged, not sending");
+        return 0;
+    }
+
+    int err = send_keyboard_report_to_endpoint(keyboard_report);
+    last_keyboard_report_valid = (err == 0);
+    if (last_keyboard_report_valid) {
+        memcpy(&last_keyboard_report, keyboard_report, sizeof(*keyboard_report));
+    }
+
+    return err;
+}
+
+static int send_consumer_report() {
+    struct zmk_hid_consumer_report *consumer_report = zmk_hid_get_consumer_report();
+
+    if (last_consumer_report_valid &&
+        memcmp(&last_consumer_report, consumer_report, sizeof(*consumer_report)) == 0) {
+        LOG_DBG("Consumer report unchanged, not sending");
+        return 0;
+    }
+
+    int err = send_consumer_report_to_endpoint(consumer_report);
+    last_consumer_report_valid = (err == 0);
+    if (last_consumer_report_valid) {
+        memcpy(&last_consumer_report, consumer_report, sizeof(*consumer_report));
+    }
+
+    return err;
+}
+
+static int send_keyboard_report_to_endpoint(struct zmk_hid_keyboard_report *keyboard_report) {
+#if IS_ENABLED(CONFIG_ZMK_HID_BENCHMARK)
+    return zmk_hid_benchmark_send_report((uint8_t *)keyboard_report, sizeof(*keyboard_report));
+#else
     switch (current_endpoint) {
 #if IS_ENABLED(CONFIG_ZMK_USB)
     case ZMK_ENDPOINT_USB: {
@@ -98,11 +150,13 @@ static int send_keyboard_report() {
         LOG_ERR("Unsupported endpoint %d", current_endpoint);
         return -ENOTSUP;
     }
+#endif /* IS_ENABLED(CONFIG_ZMK_HID_BENCHMARK) */
 }
 
-static int send_consumer_report() {
-    struct zmk_hid_consumer_report *consumer_report = zmk_hid_get_consumer_report();
-
+static int send_consumer_report_to_endpoint(struct zmk_hid_consumer_report *consumer_report) {
+#if IS_ENABLED(CONFIG_ZMK_HID_BENCHMARK)
+    return zmk_hid_benchmark_send_report((uint8_t *)consumer_report, sizeof(*consumer_report));
+#else
     switch (current_endpoint) {
 #if IS_ENABLED(CONFIG_ZMK_USB)
     case ZMK_ENDPOINT_USB: {
@@ -128,6 +182,7 @@ static int send_consumer_report() {
         LOG_ERR("Unsupported endpoint %d", current_endpoint);
         return -ENOTSUP;
     }
+#endif /* IS_ENABLED(CONFIG_ZMK_HID_BENCHMARK) */
 }
 
 int zmk_endpoints_send_report(uint16_t usage_page) {
@@ -147,6 +202,9 @@ int zmk_endpoints_send_report(uint16_t usage_page) {
 int zmk_endpoints_send_mouse_report() {
     struct zmk_hid_mouse_report *mouse_report = zmk_hid_get_mouse_report();
 
+#if IS_ENABLED(CONFIG_ZMK_HID_BENCHMARK)
+    return zmk_hid_benchmark_send_report((uint8_t *)mouse_report, sizeof(*mouse_report));
+#else
     switch (current_endpoint) {
 #if IS_ENABLED(CONFIG_ZMK_USB)
     case ZMK_ENDPOINT_USB: {
@@ -176,6 +234,7 @@ int zmk_endpoints_send_mouse_report() {
         LOG_ERR("Unsupported endpoint %d", current_endpoint);
         return -ENOTSUP;
     }
+#endif /* IS_ENABLED(CONFIG_ZMK_HID_BENCHMARK) */
 }
 
 #if IS_ENABLED(CONFIG_SETTINGS)
@@ -276,6 +335,7 @@ static void update_current_endpoint() {
         disconnect_current_endpoint();
 
         current_endpoint = new_endpoint;
+        invalidate_last_reports();
         LOG_INF("Endpoint changed: %d", current_endpoint);
 
         ZMK_EVENT_RAISE(new_zmk_endpoint_selection_changed(
@@ -284,6 +344,9 @@ static void update_current_endpoint() {
 }
 
 static int endpoint_listener(const zmk_event_t *eh) {
+    // The host behind the endpoint may have changed (new BLE profile, USB re-enumeration), so it
+    // needs the next reports even if they match what was sent last.
+    invalidate_last_reports();
     update_current_endpoint();
     return 0;
 }
@@ -1,26 +0,0 @@
-// Filename: kb_icons_big_bmp_c
-// Width: 48 Height: 48 Sprite width: 48 Sprite height: 48
-// File size
-const unsigned long HDL_IMG_SIZE_kb_icons_big_bmp_c = 299;
-// File output
-const unsigned char HDL_IMG_kb_icons_big_bmp_c[] = {
-0x00, 0x00, 0x20, 0x01, 0x30, 0x00, 0x30, 0x00, 0x30, 0x30, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 
-0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xC0, 0x0F, 0xFF, 0xE0, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 
-0xC0, 0x01, 0xFF, 0xFF, 0x8F, 0xFF, 0x80, 0x83, 0xFF, 0xFF, 0x1F, 0xFE, 0x03, 0x87, 0xFF, 0xFE, 
-0x3F, 0xFE, 0x0F, 0x07, 0xFF, 0xFC, 0x7F, 0xFC, 0x1F, 0x0F, 0xFF, 0xF8, 0xFF, 0xF8, 0x3F, 0x0F, 
-0xFF, 0xF1, 0xFF, 0xF0, 0x7E, 0x0F, 0xFF, 0xE3, 0xFF, 0xF0, 0xFE, 0x1F, 0xFF, 0xC7, 0xFF, 0xE0, 
-0xFE, 0x1F, 0xFF, 0xC0, 0x0F, 0xE1, 0xFE, 0x1F, 0xFF, 0xC0, 0x0F, 0xC1, 0xFE, 0x1F, 0xFF, 0xFF, 
-0xFF, 0xC3, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xC3, 0xFE, 0x1F, 0xE0, 0x3F, 0xFF, 0x83, 0xFE, 0x1F, 
-0xFF, 0x3F, 0xFF, 0x87, 0xFE, 0x1F, 0xFE, 0x7F, 0xFF, 0x87, 0xFF, 0x0F, 0xFC, 0xFF, 0xFF, 0x87, 
-0xFF, 0x0F, 0xF9, 0xFF, 0xFF, 0x87, 0xFF, 0x0F, 0xF3, 0xFF, 0xFF, 0x87, 0xFF, 0x87, 0xE7, 0xFF, 
-0xFF, 0x87, 0xFF, 0x83, 0xE0, 0x3F, 0xFF, 0x87, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xC1, 
-0xFF, 0xFF, 0xFF, 0x87, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xC3, 
-0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xC3, 0xFF, 0xFC, 0x07, 0xFF, 0x1F, 0xE1, 0xFF, 0xFE, 0x00, 0x20, 
-0x0F, 0xE1, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xF0, 0x7F, 0xFF, 
-0xF8, 0x00, 0x1F, 0xF8, 0x3F, 0xFF, 0xFF, 0xF8, 0x3F, 0xF8, 0x1F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFC, 
-0x0F, 0xFF, 0xFF, 0xE0, 0x7F, 0xFE, 0x07, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0x01, 
-0xFF, 0xFF, 0x80, 0x7F, 0xFC, 0x07, 0xFF, 0xFF, 0xC0, 0x07, 0xC0, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 
-0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-};
@@ -1,116 +0,0 @@
-// Filename: kb_icons_bmp_c
-// Width: 192 Height: 72 Sprite width: 24 Sprite height: 24
-// File size
-const unsigned long HDL_IMG_SIZE_kb_icons_bmp_c = 1739;
-// File output
-const unsigned char HDL_IMG_kb_icons_bmp_c[] = {
-0x00, 0x00, 0xC0, 0x06, 0xC0, 0x00, 0x48, 0x00, 0x18, 0x18, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBE, 0xFF, 
-0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x63, 0x7F, 0xFF, 0x63, 0x7F, 0xFF, 0x63, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFE, 0x3F, 0xDD, 0xFF, 0xFF, 0xDD, 0xFF, 
-0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 
-0xFF, 0xFC, 0x1F, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 
-0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x81, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 
-0xFF, 0xF1, 0xF7, 0xFF, 0x7E, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0x01, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x18, 0x7F, 0xFF, 0xF0, 0xE7, 0xFF, 0x7E, 0xFF, 0xFC, 0x00, 
-0x3F, 0xFC, 0x7E, 0x3F, 0x07, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x18, 0x7F, 
-0xFF, 0xE0, 0x07, 0xC0, 0x00, 0x03, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x0F, 0xFF, 0xF0, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x18, 0x3F, 0xFF, 0xC0, 0x0F, 0xC0, 0x00, 0x03, 0xC0, 0x00, 
-0x03, 0xE0, 0x00, 0x07, 0x9F, 0x00, 0xF9, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x18, 0x3F, 
-0xFF, 0x80, 0x3F, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x3F, 0xFC, 
-0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF8, 0x18, 0x1F, 0xFF, 0x03, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x00, 
-0x07, 0x82, 0x00, 0x31, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x18, 0x1F, 
-0xFE, 0x07, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0x82, 0x00, 0x31, 0xF8, 0x7E, 0x1F, 0xF8, 
-0x7E, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFC, 0x0F, 0xFF, 0xC0, 0x00, 0x03, 0xE3, 0x81, 
-0xC7, 0x8F, 0x80, 0x01, 0xFC, 0xFF, 0x3F, 0xFC, 0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 
-0xF8, 0x1F, 0xFF, 0xC0, 0x00, 0x03, 0xE3, 0x81, 0xC7, 0x82, 0x01, 0x81, 0xFF, 0xE7, 0xFF, 0xFF, 
-0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xE0, 0x18, 0x07, 0xF1, 0x3F, 0xFF, 0xC0, 0x00, 0x03, 0xE3, 0x81, 
-0xC7, 0x82, 0x01, 0x81, 0xFF, 0xC3, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC3, 0xFF, 0xE0, 0x18, 0x07, 
-0xF0, 0x7F, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0xFF, 0xC3, 0xFF, 0xFF, 
-0xC3, 0xFF, 0xFF, 0xC3, 0xFF, 0xC0, 0x00, 0x03, 0xF8, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x00, 
-0x07, 0xE0, 0x00, 0x07, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE7, 0xFF, 0xC0, 0x00, 0x03, 
-0xFD, 0xFF, 0xFF, 0xC0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xF0, 0x3C, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x07, 0xE0, 0x00, 
-0x07, 0xF8, 0x7E, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFF, 0xFF, 0x81, 
-0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFE, 0x07, 0xF7, 
-0xFF, 0x81, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 
-0x81, 0xFF, 0xFF, 0x81, 0xFF, 0xFC, 0x4F, 0xCF, 0xFF, 0x81, 0xFF, 0xE1, 0x1F, 0xFF, 0xFF, 0x99, 
-0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x99, 0xFF, 0xF8, 0x9F, 0xBF, 
-0xFF, 0x99, 0xFF, 0xE3, 0x8F, 0xFF, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 
-0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xF1, 0x9F, 0x03, 0xFC, 0x00, 0x3F, 0xC7, 0xC7, 0xFF, 0xF8, 0x00, 
-0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xE7, 0x9F, 0xFF, 
-0xF8, 0x00, 0x1F, 0xCF, 0xE7, 0xFF, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 
-0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xC7, 0x38, 0x7F, 0xF9, 0xFF, 0x9F, 0xC7, 0xA7, 0xFF, 0xF9, 0x00, 
-0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0x3C, 0x9F, 0xCF, 0x3E, 0xFF, 
-0xF9, 0xF9, 0x9F, 0xE3, 0x07, 0xFF, 0xF9, 0x00, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 
-0xFF, 0x9F, 0xF9, 0x3C, 0x9F, 0x8F, 0x3D, 0xFF, 0xF9, 0xF1, 0x9F, 0xF1, 0x8F, 0xFF, 0xF9, 0x00, 
-0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0x18, 0x9F, 0x9F, 0x38, 0x7F, 
-0xF9, 0xE3, 0x9F, 0xF8, 0x04, 0x3F, 0xF9, 0x00, 0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 
-0xFF, 0x9F, 0xF9, 0x81, 0x9F, 0x9F, 0x9F, 0xFF, 0xF9, 0xC7, 0x9F, 0xFC, 0x20, 0x1F, 0xF9, 0x00, 
-0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xC3, 0x9F, 0x9F, 0x9F, 0xFF, 
-0xF9, 0x8F, 0x9F, 0xFF, 0xF1, 0x8F, 0xF9, 0x00, 0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0x00, 0x9F, 0xF9, 
-0xFF, 0x9F, 0xF9, 0xE7, 0x9F, 0x9F, 0x8F, 0xFF, 0xF9, 0xC1, 0x9F, 0xFF, 0xE0, 0xC7, 0xF9, 0x00, 
-0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xC3, 0x9F, 0x9F, 0xC7, 0xFF, 
-0xF9, 0xE3, 0x9F, 0xFF, 0xE5, 0xE3, 0xF9, 0x00, 0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0x00, 0x9F, 0xF9, 
-0xFF, 0x9F, 0xF9, 0x81, 0x9F, 0xCF, 0xE1, 0xF9, 0xF9, 0xC7, 0x9F, 0xFF, 0xE7, 0xF3, 0xF9, 0x00, 
-0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0x18, 0x9F, 0xCF, 0xF0, 0x01, 
-0xF9, 0x8F, 0x9F, 0xFF, 0xE3, 0xE3, 0xF9, 0x00, 0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0x00, 0x9F, 0xF9, 
-0x00, 0x9F, 0xF9, 0x3C, 0x9F, 0xE7, 0xFC, 0x01, 0xF9, 0x9F, 0x9F, 0xFF, 0xF1, 0xC7, 0xF9, 0x00, 
-0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0x00, 0x9F, 0xF9, 0x3C, 0x9F, 0xE3, 0xFF, 0xE3, 
-0xF9, 0xFF, 0x9F, 0xFF, 0xF8, 0x07, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF9, 
-0xFF, 0x9F, 0xF9, 0xFF, 0x9F, 0xF1, 0xFF, 0xC7, 0xF9, 0xFF, 0x9F, 0xFF, 0xFC, 0x0F, 0xF8, 0x00, 
-0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xFC, 0xFF, 0x0F, 
-0xF8, 0x00, 0x1F, 0xFF, 0xFE, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFC, 
-0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFC, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 
-0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xF8, 0x3C, 0x1F, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x8F, 0xC0, 0x00, 
-0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xC7, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xE7, 0xC0, 0x3C, 
-0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xF3, 0xC0, 0x3C, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x33, 0xC0, 0x7E, 
-0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x9F, 0xFE, 0x39, 0xC0, 0x66, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0xFC, 0x79, 0xC0, 0xE7, 
-0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x9E, 0x78, 0xF9, 0xC0, 0xC3, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x31, 0xF9, 0xC0, 0xC3, 
-0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0x9F, 0x03, 0xF9, 0xC1, 0xFF, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x87, 0xF9, 0xC1, 0xFF, 
-0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xCF, 0xCF, 0xF3, 0xC3, 0x81, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0xE3, 0xC3, 0x81, 
-0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xE7, 0xFF, 0xE7, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xC7, 0xC0, 0x00, 
-0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xF1, 0xFF, 0x0F, 0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3C, 0x1F, 0xE0, 0x00, 
-0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-};
@@ -9,19 +9,28 @@
 #include <logging/log.h>
 #include <string.h>
 #include <time.h>
-#include <math.h>
 
 #if IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
 // Central
+#include <zmk/split/central.h>
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE)
 #include <zmk/split/bluetooth/central.h>
+#endif
 
 #elif IS_ENABLED(CONFIG_ZMK_SPLIT)
 // Peripheral
-#include <zmk/split/bluetooth/peripheral.h>
+#include <zmk/split/peripheral.h>
 #endif
 #include <zmk/keymap.h>
 #include <zmk/ble.h>
 
+#include <zmk/event_manager.h>
+#include <zmk/events/battery_state_changed.h>
+#include <zmk/events/usb_conn_state_changed.h>
+#include <zmk/events/layer_state_changed.h>
+#include <zmk/events/ble_active_profile_changed.h>
+#include <zmk/events/endpoint_selection_changed.h>
+#include <zmk/events/split_peripheral_status_changed.h>
 #include <zmk/events/wpm_state_changed.h>
 #include <zmk/wpm.h>
 #include <zmk/endpoints.h>
@@ -51,6 +60,84 @@ enum dsp_view {
     VIEW_SLEEP
 };
 
+// Binding IDs, as referenced by the HDL layouts
+enum dsp_bind_id {
+    BIND_VIEW = 1,
+    BIND_BATT_PERCENT = 2,
+    BIND_BATT_SPRITE = 3,
+    BIND_CHRG = 4,
+    BIND_RSSI = 5,
+    BIND_SENSITIVITY = 6,
+    BIND_LAYER = 7,
+    BIND_BTPROFILE = 8,
+    BIND_SPLITCONNECTED = 9,
+    BIND_WPM = 10,
+    BIND_CONNECTION_STATUS = 11,
+    BIND_HOST_DISCONNECTED = 12,
+    BIND_SPLIT_LOST = 13,
+    BIND_HASTIME = 20,
+    BIND_HOURS = 21,
+    BIND_MINUTES = 22,
+    BIND_YEAR = 23,
+    BIND_MONTH = 24,
+    BIND_DAY = 25,
+    BIND_WEEKDAY = 26
+};
+
+#define BIND_MASK(id)           BIT(id)
+
+#define BIND_MASK_BATTERY       (BIND_MASK(BIND_BATT_PERCENT) | BIND_MASK(BIND_BATT_SPRITE) | BIND_MASK(BIND_CHRG))
+#define BIND_MASK_CONNECTION    (BIND_MASK(BIND_BTPROFILE) | BIND_MASK(BIND_CONNECTION_STATUS) | BIND_MASK(BIND_HOST_DISCONNECTED))
+#define BIND_MASK_SPLIT         (BIND_MASK(BIND_SPLITCONNECTED) | BIND_MASK(BIND_RSSI) | BIND_MASK(BIND_SPLIT_LOST))
+#define BIND_MASK_TIME          (BIND_MASK(BIND_HASTIME) | BIND_MASK(BIND_HOURS) | BIND_MASK(BIND_MINUTES) | \
+                                 BIND_MASK(BIND_YEAR) | BIND_MASK(BIND_MONTH) | BIND_MASK(BIND_DAY) | BIND_MASK(BIND_WEEKDAY))
+// Values without a change event, refreshed on the idle tick
+#define BIND_MASK_POLLED        (BIND_MASK_TIME | BIND_MASK(BIND_RSSI) | BIND_MASK(BIND_SPLIT_LOST) | BIND_MASK(BIND_SENSITIVITY))
+#define BIND_MASK_ALL           0xFFFFFFFF
+
+// Minimum time between renders, HDL skips updates closer together than this
+#define DISPLAY_MIN_UPDATE_MS   300
+// Polling interval of values without a change event (RSSI, lost events) when there is no clock
+#define DISPLAY_IDLE_UPDATE_MS  30000
+// Panel stays powered this long after a refresh, so bursts of updates (e.g. WPM) skip power up
+#define DISPLAY_POWER_HOLD_MS   3000
+// Idle time before deep sleep, waking from it costs a reset, register init and full RAM upload.
+// Longer than the clock's minute updates, so those only power the panel back on
+#define DISPLAY_HIBERNATE_MS    300000
+
+// Bindings changed since the last render, bit per binding ID
+static atomic_t dirty_bindings = ATOMIC_INIT(0);
+// Set when the layout was rebuilt and has to be redrawn completely
+static atomic_t force_update = ATOMIC_INIT(0);
+// Uptime of the last render
+static int64_t last_update_time = 0;
+
+// Held from the start of a panel refresh until it has finished, nothing draws meanwhile
+K_SEM_DEFINE(display_refresh_sem, 1, 1);
+// Set when an update was skipped because the panel was refreshing
+static bool update_deferred = false;
+// Uptime the last refresh finished, the panel's idle time is measured from it
+static int64_t last_refresh_time = 0;
+// Set while the ghosting clean up before deep sleep is running
+static bool idle_clean = false;
+// Set once the sleep view is on the panel, nothing is drawn after it
+static bool display_sleeping = false;
+
+// Area drawn by the current HDL update, refreshed in one go once it's done
+static struct {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+} render_area;
+
+K_THREAD_STACK_DEFINE(hdl_display_work_stack, 4096);
+static struct k_work_q display_work_q;
+
+static void display_mark_dirty (atomic_val_t mask);
+static void display_poll_restart ();
+static void text_cache_clear ();
+
 // *******************************
 // ZMK_CONFIG_KEY_DATETIME field
 // *******************************
@@ -82,6 +169,8 @@ struct {
     uint8_t layer;
     uint8_t btProfile;
     uint8_t splitConnected;
+    // Split events lost or dropped on the way to the central
+    uint16_t splitLost;
     uint16_t wpm;
     uint8_t connectionStatus;
     uint8_t hostDisconnected;
@@ -101,6 +190,71 @@ struct {
 
 } dsp_binds;
 
+// Bound values as of the last render that drew something
+static uint8_t rendered_binds[sizeof(dsp_binds)];
+
+struct dsp_binding {
+    const char *name;
+    uint8_t id;
+    uint8_t size;
+    void *value;
+    int type;
+};
+
+#define DSP_BINDING(_name, _id, _field, _type)                                                      \
+    {.name = _name, .id = _id, .size = sizeof(dsp_binds._field), .value = &dsp_binds._field,        \
+     .type = _type}
+
+static const struct dsp_binding dsp_bindings[] = {
+    DSP_BINDING("VIEW",                 BIND_VIEW,              view,               HDL_TYPE_I8),
+    DSP_BINDING("BATT_PERCENT",         BIND_BATT_PERCENT,      batt_percent,       HDL_TYPE_I8),
+    DSP_BINDING("BATT_SPRITE",          BIND_BATT_SPRITE,       batt_sprite,        HDL_TYPE_I8),
+    DSP_BINDING("CHRG",                 BIND_CHRG,              charge,             HDL_TYPE_BOOL),
+    DSP_BINDING("RSSI",                 BIND_RSSI,              rssi,               HDL_TYPE_I8),
+
+    DSP_BINDING("SENSITIVITY",          BIND_SENSITIVITY,       sensitivity,        HDL_TYPE_I16),
+
+    DSP_BINDING("LAYER",                BIND_LAYER,             layer,              HDL_TYPE_I8),
+    DSP_BINDING("BTPROFILE",            BIND_BTPROFILE,         btProfile,          HDL_TYPE_I8),
+    DSP_BINDING("SPLITCONNECTED",       BIND_SPLITCONNECTED,    splitConnected,     HDL_TYPE_BOOL),
+    DSP_BINDING("WPM",                  BIND_WPM,               wpm,                HDL_TYPE_I16),
+    DSP_BINDING("CONNECTION_STATUS",    BIND_CONNECTION_STATUS, connectionStatus,   HDL_TYPE_I8),
+    DSP_BINDING("HOST_DISCONNECTED",    BIND_HOST_DISCONNECTED, hostDisconnected,   HDL_TYPE_BOOL),
+    DSP_BINDING("SPLIT_LOST",           BIND_SPLIT_LOST,        splitLost,          HDL_TYPE_I16),
+
+    // Time and date
+    DSP_BINDING("HASTIME",              BIND_HASTIME,           hasTime,            HDL_TYPE_BOOL),
+    DSP_BINDING("HOURS",                BIND_HOURS,             hours,              HDL_TYPE_I8),
+    DSP_BINDING("MINUTES",              BIND_MINUTES,           minutes,            HDL_TYPE_I8),
+
+    DSP_BINDING("YEAR",                 BIND_YEAR,              year,               HDL_TYPE_I16),
+    DSP_BINDING("MONTH",                BIND_MONTH,             month,              HDL_TYPE_I8),
+    DSP_BINDING("DAY",                  BIND_DAY,               day,                HDL_TYPE_I8),
+    DSP_BINDING("WEEKDAY",              BIND_WEEKDAY,           weekDay,            HDL_TYPE_I8),
+};
+
+// Bit per binding ID whose value differs from the last render
+static uint32_t changed_bindings () {
+    uint32_t changed = 0;
+
+    for(int i = 0; i < ARRAY_SIZE(dsp_bindings); i++) {
+        const struct dsp_binding *binding = &dsp_bindings[i];
+        size_t offset = (uint8_t *)binding->value - (uint8_t *)&dsp_binds;
+
+        if(memcmp(binding->value, &rendered_binds[offset], binding->size) != 0) {
+            changed |= BIND_MASK(binding->id);
+        }
+    }
+
+    return changed;
+}
+
+// Current time in seconds, as set over zmk_control
+static int64_t conf_time_now () {
+    return (conf_time.timestamp + conf_time.offset) +
+           ((int64_t)(k_uptime_get() - _conf_time_last_update) / 1000);
+}
+
 // Refresh clock texts
 void conf_time_refresh () {
     if(conf_time.timestamp == 0) {
@@ -113,8 +267,7 @@ void conf_time_refresh () {
         dsp_binds.hasTime = 0;
     }
     else {
-        uint64_t nclock = k_uptime_get();
-        conf_time_timestamp = (conf_time.timestamp + conf_time.offset) + ((nclock - _conf_time_last_update)/1000);
+        conf_time_timestamp = conf_time_now();
         time_t tmr = conf_time_timestamp;
 
         struct tm *_tm = localtime(&tmr);
@@ -131,7 +284,9 @@ void conf_time_refresh () {
 // Time received via zmk_control callback
 void conf_time_updated () {
     _conf_time_last_update = k_uptime_get();
-    conf_time_refresh();
+    display_mark_dirty(BIND_MASK_TIME);
+    // The minute boundary moved with the new time
+    display_poll_restart();
 }
 
 // Display received via zmk_control callback
@@ -160,23 +315,57 @@ void conf_display_updated () {
     HDL_Free(&interface);
 
     HDL_Build(&interface, HDL_DATA, HDL_DATA_LEN);
+    text_cache_clear();
+
+    k_mutex_unlock(&hdl_mutex);
 
+    // Drawing and refreshing happens on the display queue, the config push doesn't wait for it
     if(hdl_initialized) {
-        HDL_ForceUpdate(&interface);
-        il0323_hibernate(display);
+        atomic_set(&force_update, 1);
+        display_mark_dirty(BIND_MASK_ALL);
     }
 
-    k_mutex_unlock(&hdl_mutex);
+}
 
+static void render_area_reset () {
+    render_area.x0 = INT16_MAX;
+    render_area.y0 = INT16_MAX;
+    render_area.x1 = INT16_MIN;
+    render_area.y1 = INT16_MIN;
 }
 
+#if IS_ENABLED(CONFIG_ZEPHYR_HDL_STATS)
+// Logs the bound values picking what the render showed
+static void display_log_binds () {
+    LOG_INF("stats,binds,%u,%u", dsp_binds.view, dsp_binds.layer);
+}
+#endif
+
 // Set sleep view
 void display_set_sleep () {
+    // The activity timer calls this again if powering off returned
+    if(display_sleeping) {
+        return;
+    }
+    display_sleeping = true;
+
+    // Wait for a refresh in flight. Never given back, so the update work stops drawing
+    k_sem_take(&display_refresh_sem, K_FOREVER);
     // Lock the mutex forever since we are going to sleep
     k_mutex_lock(&hdl_mutex, K_FOREVER);
     dsp_binds.view = VIEW_SLEEP;
     // This will be the last render until reboot
+    render_area_reset();
+    text_cache_clear();
     HDL_ForceUpdate(&interface);
+#if IS_ENABLED(CONFIG_ZEPHYR_HDL_STATS)
+    display_log_binds();
+#endif
+    // The device powers off right after, so wait for the panel here
+    if(render_area.x1 > render_area.x0) {
+        il0323_refresh(display, render_area.x0, render_area.y0,
+                       render_area.x1 - render_area.x0, render_area.y1 - render_area.y0);
+    }
     il0323_hibernate(display);
 }
 
@@ -222,57 +411,214 @@ void update_battery_sprite () {
     }
 }
 
+// Font glyph size in pixels
+#define GLYPH_WIDTH             6
+#define GLYPH_HEIGHT            8
+
+// Pre-scaled glyphs, the least recently used one is replaced on a miss
+#define GLYPH_CACHE_SIZE        24
+// Larger font sizes are scaled while drawing
+#define GLYPH_CACHE_MAX_SIZE    4
+
+struct glyph_cache_entry {
+    uint8_t c;
+    // Font size, 0 for an unused entry
+    uint8_t size;
+    uint16_t used;
+    // Rows scaled horizontally, each one is drawn size times
+    uint8_t rows[GLYPH_HEIGHT][(GLYPH_WIDTH * GLYPH_CACHE_MAX_SIZE + 7) / 8];
+};
+
+static struct glyph_cache_entry glyph_cache[GLYPH_CACHE_SIZE];
+static uint16_t glyph_cache_clock = 0;
+
+static const struct glyph_cache_entry *glyph_cache_get (uint8_t c, uint8_t size) {
+    struct glyph_cache_entry *victim = &glyph_cache[0];
+
+    glyph_cache_clock++;
+
+    for(int i = 0; i < GLYPH_CACHE_SIZE; i++) {
+        struct glyph_cache_entry *entry = &glyph_cache[i];
+
+        if(entry->size == size && entry->c == c) {
+            entry->used = glyph_cache_clock;
+            return entry;
+        }
+
+        // Unused entries first, then the one unused for longest
+        if(victim->size != 0 && (entry->size == 0 ||
+           (uint16_t)(glyph_cache_clock - entry->used) > (uint16_t)(glyph_cache_clock - victim->used))) {
+            victim = entry;
+        }
+    }
+
+    memset(victim->rows, 0, sizeof(victim->rows));
+    for(int py = 0; py < GLYPH_HEIGHT; py++) {
+        uint8_t bits = HDL_FONT[c * GLYPH_HEIGHT + py];
+        for(int px = 0; px < GLYPH_WIDTH; px++) {
+            if(!(bits & (0x80 >> px))) {
+                continue;
+            }
+            for(int sx = px * size; sx < (px + 1) * size; sx++) {
+                victim->rows[py][sx / 8] |= 0x80 >> (sx % 8);
+            }
+        }
+    }
+
+    victim->c = c;
+    victim->size = size;
+    victim->used = glyph_cache_clock;
+
+    return victim;
+}
+
+// Texts currently on the framebuffer, redrawing one of them unchanged is skipped
+#define TEXT_CACHE_SIZE         8
+#define TEXT_CACHE_MAX_LEN      15
+
+struct text_cache_entry {
+    bool valid;
+    uint8_t size;
+    int16_t x;
+    int16_t y;
+    uint16_t w;
+    uint16_t h;
+    char text[TEXT_CACHE_MAX_LEN + 1];
+};
+
+static struct text_cache_entry text_cache[TEXT_CACHE_SIZE];
+static uint8_t text_cache_next = 0;
+
+// Forgets texts that a clear or another drawing has (partly) overwritten
+static void text_cache_invalidate (int16_t x, int16_t y, uint16_t w, uint16_t h) {
+    for(int i = 0; i < TEXT_CACHE_SIZE; i++) {
+        struct text_cache_entry *entry = &text_cache[i];
+        if(entry->valid && x < entry->x + entry->w && entry->x < x + w &&
+           y < entry->y + entry->h && entry->y < y + h) {
+            entry->valid = false;
+        }
+    }
+}
+
+// Forgets all texts, for a new layout or a full redraw
+static void text_cache_clear () {
+    memset(text_cache, 0, sizeof(text_cache));
+    text_cache_next = 0;
+}
+
+// Returns true if the same text is already drawn here, otherwise remembers it
+static bool text_cache_check (int16_t x, int16_t y, const char *text, uint8_t fontSize,
+                              uint16_t w, uint16_t h) {
+    if(strlen(text) > TEXT_CACHE_MAX_LEN) {
+        return false;
+    }
+
+    struct text_cache_entry *entry = NULL;
+    for(int i = 0; i < TEXT_CACHE_SIZE; i++) {
+        if(text_cache[i].valid && text_cache[i].x == x && text_cache[i].y == y) {
+            entry = &text_cache[i];
+            break;
+        }
+    }
+
+    if(entry != NULL && entry->size == fontSize && strcmp(entry->text, text) == 0) {
+        return true;
+    }
+
+    if(entry == NULL) {
+        entry = &text_cache[text_cache_next];
+        text_cache_next = (text_cache_next + 1) % TEXT_CACHE_SIZE;
+    }
+
+    // Drawing over a different text doesn't erase it, so the union has to be invalidated by a clear
+    if(entry->valid && entry->x == x && entry->y == y) {
+        w = MAX(w, entry->w);
+        h = MAX(h, entry->h);
+    }
+
+    entry->valid = true;
+    entry->size = fontSize;
+    entry->x = x;
+    entry->y = y;
+    entry->w = w;
+    entry->h = h;
+    strcpy(entry->text, text);
+
+    return false;
+}
+
 // Interface for clearing an area on the display
 void dsp_clear (int16_t x, int16_t y, uint16_t w, uint16_t h) {
+    text_cache_invalidate(x, y, w, h);
     il0323_clear_area(display, x, y, w, h);
 }
 
 // Interface for triggering render on the display
 void dsp_render (int16_t x, int16_t y, uint16_t w, uint16_t h) {
-    il0323_refresh(display, x, y, w, h);
+    if(w == 0 || h == 0) {
+        return;
+    }
+    render_area.x0 = MIN(render_area.x0, x);
+    render_area.y0 = MIN(render_area.y0, y);
+    render_area.x1 = MAX(render_area.x1, x + w);
+    render_area.y1 = MAX(render_area.y1, y + h);
 }
 
 // Interface for drawing single pixel on the display
 void dsp_pixel (int16_t x, int16_t y) {
+    text_cache_invalidate(x, y, 1, 1);
     il0323_set_pixel(display, x, y);
 }
 
 // Interface for drawing horizontal line on the display
 void dsp_hline (int16_t x, int16_t y, int16_t len) {
+    text_cache_invalidate(x, y, len, 1);
     il0323_h_line(display, x, y, len);
 }
 
 // Interface for drawing vertical line on the display
 void dsp_vline (int16_t x, int16_t y, int16_t len) {
+    text_cache_invalidate(x, y, 1, len);
     il0323_v_line(display, x, y, len);
 }
 
-#define PI 3.14159265
-
-void dsp_arc(int16_t xc, int16_t yc, int16_t radius, uint16_t start_angle, uint16_t end_angle) {
-    int x, y;
-    float angle;
-
-    // Iterate through the angles from start_angle to end_angle
-    for (angle = start_angle; angle < end_angle; angle += 1) {
-
-        x = xc + radius * cosf(angle * PI / 180.0) - 0.5f;
-        y = yc + radius * sinf(angle * PI / 180.0) - 0.5f;
-
-        // Plot the point (x, y)
-        il0323_set_pixel(display, x, y);
-    }
+// Interface for drawing arcs on the display
+void dsp_arc (int16_t xc, int16_t yc, int16_t radius, uint16_t start_angle, uint16_t end_angle) {
+    // Bounding box of the whole circle
+    text_cache_invalidate(xc - radius, yc - radius, 2 * radius + 1, 2 * radius + 1);
+    il0323_arc(display, xc, yc, radius, start_angle, end_angle);
 }
 
-// Font
-extern const char HDL_FONT[2048];
-
 // Interface for drawing text on the display
 void dsp_text (int16_t x, int16_t y, const char *text, uint8_t fontSize) {
 
     int len = strlen(text);
     int line = 0;
     int acol = 0;
+    int cols = 0;
+
+    if (fontSize == 0) {
+        return;
+    }
+
+    // Size of the drawn text
+    for (int g = 0; g < len; g++) {
+        if (text[g] == '\n') {
+            line++;
+            acol = 0;
+            continue;
+        }
+        acol++;
+        cols = MAX(cols, acol);
+    }
+
+    if (text_cache_check(x, y, text, fontSize, cols * GLYPH_WIDTH * fontSize,
+                         (line + 1) * GLYPH_HEIGHT * fontSize)) {
+        return;
+    }
+
+    line = 0;
+    acol = 0;
 
     for (int g = 0; g < len; g++) {
 		// Starting character in single quotes
@@ -287,84 +633,393 @@ void dsp_text (int16_t x, int16_t y, const char *text, uint8_t fontSize) {
             continue;
 		}
 		
-		for (int py = 0; py < 8; py++) {
-			for (int px = 0; px < 6; px++) {
-				if ((HDL_FONT[text[g] * 8 + py] >> (7 - px)) & 1) {
-                    int rx = x + (px + acol * 6) * fontSize;
-                    int ry = y + (py + line * 8) * fontSize;
-
-                    for(int sy = 0; sy < fontSize; sy++) {
-                        for(int sx = 0; sx < fontSize; sx++) {
-                            dsp_pixel(rx + sx, ry + sy);
-                        }
-                    }
-				}
-			}
+		int gx = x + acol * GLYPH_WIDTH * fontSize;
+		int gy = y + line * GLYPH_HEIGHT * fontSize;
+
+		if (fontSize <= GLYPH_CACHE_MAX_SIZE) {
+			const struct glyph_cache_entry *glyph = glyph_cache_get(text[g], fontSize);
+			il0323_blit_rows(display, gx, gy, &glyph->rows[0][0], sizeof(glyph->rows[0]),
+			                 GLYPH_WIDTH * fontSize, GLYPH_HEIGHT, fontSize);
+		} else {
+			// Glyphs are 8 rows of one byte
+			const uint8_t *rows = (const uint8_t *)&HDL_FONT[(uint8_t)text[g] * GLYPH_HEIGHT];
+			il0323_blit(display, gx, gy, rows, 1, GLYPH_WIDTH, GLYPH_HEIGHT, fontSize);
 		}
 		acol++;
 
     }
 }
 
-static void update_display_bindings () {
-    // Update battery
-    dsp_binds.batt_percent = zmk_battery_state_of_charge();
-    update_battery_sprite();
-    // Update time
-    conf_time_refresh();
+static void update_display_bindings (atomic_val_t dirty) {
+    if(dirty & BIND_MASK_BATTERY) {
+        dsp_binds.batt_percent = zmk_battery_state_of_charge();
+        update_battery_sprite();
+    }
+
+    if(dirty & BIND_MASK_TIME) {
+        conf_time_refresh();
+    }
 
     #ifdef CONFIG_ZMK_CONFIG
-    struct zmk_config_field *sens = zmk_config_get(ZMK_CONFIG_KEY_MOUSE_SENSITIVITY);
-    if(sens) {
-        dsp_binds.sensitivity = *(uint8_t*)sens->data;
+    if(dirty & BIND_MASK(BIND_SENSITIVITY)) {
+        struct zmk_config_field *sens = zmk_config_get(ZMK_CONFIG_KEY_MOUSE_SENSITIVITY);
+        if(sens) {
+            dsp_binds.sensitivity = *(uint8_t*)sens->data;
+        }
     }
     #endif
 
     #ifdef CONFIG_ZMK_WPM
-    dsp_binds.wpm = zmk_wpm_get_state();
+    if(dirty & BIND_MASK(BIND_WPM)) {
+        dsp_binds.wpm = zmk_wpm_get_state();
+    }
     #endif
 
-    #if IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
-    // Central
-    dsp_binds.splitConnected = zmk_split_bt_central_is_connected();
+    if(dirty & BIND_MASK_SPLIT) {
+        #if IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL)
+        // Central
+        dsp_binds.splitConnected = zmk_split_central_is_connected();
 
-    #elif IS_ENABLED(CONFIG_ZMK_SPLIT)
-    // Peripheral
-    dsp_binds.splitConnected = zmk_split_bt_peripheral_is_connected();
-    #endif
+        #if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE)
+        struct zmk_split_link_stats stats;
+        if(zmk_split_bt_central_get_link_stats(0, &stats) == 0) {
+            dsp_binds.rssi = stats.rssi;
+            dsp_binds.splitLost = MIN(stats.lost_events + stats.dropped_events, UINT16_MAX);
+        }
+        #endif
+
+        #elif IS_ENABLED(CONFIG_ZMK_SPLIT)
+        // Peripheral
+        dsp_binds.splitConnected = zmk_split_peripheral_is_connected();
+        #endif
+    }
 
 
     #if IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL) || !IS_ENABLED(CONFIG_ZMK_SPLIT)
-    dsp_binds.layer = zmk_keymap_highest_layer_active();
-    dsp_binds.btProfile = zmk_ble_active_profile_index();
-    //
-    if(zmk_endpoints_selected() == 0) {
-        //usb ok
-        dsp_binds.hostDisconnected = 0;
-        dsp_binds.connectionStatus = zmk_endpoints_selected()+1;
-    } else if (!zmk_ble_active_profile_is_connected()) {
-        //not connected
-        dsp_binds.hostDisconnected = 1;
-        dsp_binds.connectionStatus = 0;
-    } else if (!zmk_ble_active_profile_is_open()) {
-        //is connected via bt
-        dsp_binds.hostDisconnected = 0;
-        dsp_binds.connectionStatus= 2;
-    } else {
-        //unknown situation
-        dsp_binds.hostDisconnected = 1;
-        dsp_binds.connectionStatus = 0;
+    if(dirty & BIND_MASK(BIND_LAYER)) {
+        dsp_binds.layer = zmk_keymap_highest_layer_active();
+    }
+
+    if(dirty & BIND_MASK_CONNECTION) {
+        dsp_binds.btProfile = zmk_ble_active_profile_index();
+        //
+        if(zmk_endpoints_selected() == 0) {
+            //usb ok
+            dsp_binds.hostDisconnected = 0;
+            dsp_binds.connectionStatus = zmk_endpoints_selected()+1;
+        } else if (!zmk_ble_active_profile_is_connected()) {
+            //not connected
+            dsp_binds.hostDisconnected = 1;
+            dsp_binds.connectionStatus = 0;
+        } else if (!zmk_ble_active_profile_is_open()) {
+            //is connected via bt
+            dsp_binds.hostDisconnected = 0;
+            dsp_binds.connectionStatus= 2;
+        } else {
+            //unknown situation
+            dsp_binds.hostDisconnected = 1;
+            dsp_binds.connectionStatus = 0;
+        }
     }
     #endif
 
     
 }
 
-static void display_thread(void *arg, void *unused2, void *unused3) {
-    k_msleep(100);
-    while(display == NULL) {
-        k_msleep(10000);
+static void display_update_work_callback(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(display_update_work, display_update_work_callback);
+
+static void display_poll_work_callback(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(display_poll_work, display_poll_work_callback);
+
+// Delay until the polled values are due, from the current time rather than the last render
+static k_timeout_t display_poll_timeout () {
+    if(conf_time.timestamp != 0) {
+        // Wake up as the minute changes so the clock stays correct
+        return K_SECONDS(60 - (conf_time_now() % 60));
+    }
+    return K_MSEC(DISPLAY_IDLE_UPDATE_MS);
+}
+
+// Runs on its own schedule, so a stream of event driven renders (e.g. WPM) can't postpone it
+static void display_poll_work_callback(struct k_work *work) {
+    display_mark_dirty(BIND_MASK_POLLED);
+    k_work_schedule_for_queue(&display_work_q, &display_poll_work, display_poll_timeout());
+}
+
+static void display_poll_restart () {
+    // Started along with the display
+    if(!hdl_initialized) {
+        return;
+    }
+    k_work_reschedule_for_queue(&display_work_q, &display_poll_work, display_poll_timeout());
+}
+
+static void display_refresh_done (const struct device *dev);
+
+static void display_update_work_callback(struct k_work *work) {
+    // The buffer is being sent to the panel, catch up once it's done
+    if(k_sem_take(&display_refresh_sem, K_NO_WAIT) != 0) {
+        update_deferred = true;
+        return;
+    }
+
+    atomic_val_t dirty = atomic_clear(&dirty_bindings);
+    bool held_back = false;
+
+    k_mutex_lock(&hdl_mutex, K_FOREVER);
+
+    update_display_bindings(dirty);
+
+#if IS_ENABLED(CONFIG_ZEPHYR_HDL_STATS)
+    uint32_t render_start = k_cycle_get_32();
+#endif
+
+    render_area_reset();
+    if(atomic_clear(&force_update)) {
+        text_cache_clear();
+        HDL_ForceUpdate(&interface);
+        memcpy(rendered_binds, &dsp_binds, sizeof(rendered_binds));
+#if IS_ENABLED(CONFIG_ZEPHYR_HDL_STATS)
+        display_log_binds();
+#endif
+    } else {
+        uint32_t changed = changed_bindings();
+
+        // Layout is only evaluated when a bound value differs from what is on screen
+        if(changed != 0) {
+            LOG_DBG("Display bindings changed: 0x%08x", changed);
+            // Keep the snapshot if HDL held the render back, so the change isn't lost
+            if(HDL_Update(&interface, k_uptime_get()) > 0) {
+                memcpy(rendered_binds, &dsp_binds, sizeof(rendered_binds));
+#if IS_ENABLED(CONFIG_ZEPHYR_HDL_STATS)
+                display_log_binds();
+#endif
+            } else {
+                held_back = true;
+            }
+        }
+    }
+    last_update_time = k_uptime_get();
+
+#if IS_ENABLED(CONFIG_ZEPHYR_HDL_STATS)
+    if(render_area.x1 > render_area.x0) {
+        LOG_INF("stats,update,%u,%d,%d,%d,%d",
+                k_cyc_to_us_floor32(k_cycle_get_32() - render_start), render_area.x0,
+                render_area.y0, render_area.x1 - render_area.x0, render_area.y1 - render_area.y0);
+    } else {
+        LOG_INF("stats,update,%u,0,0,0,0", k_cyc_to_us_floor32(k_cycle_get_32() - render_start));
+    }
+#endif
+
+    k_mutex_unlock(&hdl_mutex);
+
+    // Try again once HDL accepts a render, events arriving meanwhile pull this in
+    if(held_back) {
+        k_work_schedule_for_queue(&display_work_q, &display_update_work,
+                                  K_MSEC(DISPLAY_MIN_UPDATE_MS));
+    }
+
+    int ret = 0;
+    if(render_area.x1 > render_area.x0) {
+        ret = il0323_refresh_start(display, render_area.x0, render_area.y0,
+                                   render_area.x1 - render_area.x0,
+                                   render_area.y1 - render_area.y0, display_refresh_done);
+    }
+
+    if(ret < 0) {
+        LOG_ERR("Failed to refresh display (err %d)", ret);
+    }
+
+    // Nothing changed on the panel, so its power state is unchanged
+    if(ret <= 0) {
+        k_sem_give(&display_refresh_sem);
+    }
+}
+
+static void display_power_work_callback(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(display_power_work, display_power_work_callback);
+
+static void display_power_work_callback(struct k_work *work) {
+    // A refresh is running, its completion schedules this again
+    if(k_sem_take(&display_refresh_sem, K_NO_WAIT) != 0) {
+        return;
+    }
+
+    int64_t idle = k_uptime_get() - last_refresh_time;
+    int ret = 0;
+
+    if(idle < DISPLAY_HIBERNATE_MS) {
+        // The burst is over, powering back on is cheap as registers and RAM are kept
+        il0323_power_off(display);
+        k_work_reschedule_for_queue(&display_work_q, &display_power_work,
+                                    K_MSEC(DISPLAY_HIBERNATE_MS - idle));
+    } else {
+        // Nobody has looked at the panel for a while, a good moment to clean up ghosting
+        ret = il0323_clean_start(display, display_refresh_done);
+        if(ret > 0) {
+            idle_clean = true;
+            return;
+        }
+        if(ret < 0) {
+            LOG_ERR("Failed to clean display (err %d)", ret);
+        }
+        il0323_hibernate(display);
+    }
+
+    k_sem_give(&display_refresh_sem);
+}
+
+#if IS_ENABLED(CONFIG_ZEPHYR_HDL_STATS)
+// Logs what the panel did since the previous call
+static void display_log_energy () {
+    static struct il0323_stats last;
+    struct il0323_stats stats;
+
+    il0323_get_stats(display, &stats);
+    LOG_INF("stats,energy,%u,%u,%u,%u,%u,%u", stats.energy_uj - last.energy_uj,
+            stats.wakes - last.wakes, stats.power_ons - last.power_ons,
+            stats.refreshes - last.refreshes, stats.full_refreshes - last.full_refreshes,
+            stats.bytes - last.bytes);
+    last = stats;
+}
+#endif
+
+static void display_refresh_done_work_callback(struct k_work *work) {
+    int ret = il0323_refresh_finish(display);
+    if(ret > 0) {
+        // Cleaning up ghosting, display_refresh_done is called again
+        return;
+    }
+    if(ret < 0) {
+        LOG_ERR("Failed to finish display refresh (err %d)", ret);
+    }
+
+#if IS_ENABLED(CONFIG_ZEPHYR_HDL_STATS)
+    display_log_energy();
+#endif
+
+    if(idle_clean) {
+        idle_clean = false;
+        il0323_hibernate(display);
+    } else {
+        last_refresh_time = k_uptime_get();
+        k_work_reschedule_for_queue(&display_work_q, &display_power_work,
+                                    K_MSEC(DISPLAY_POWER_HOLD_MS));
+    }
+
+    k_sem_give(&display_refresh_sem);
+
+    if(update_deferred) {
+        update_deferred = false;
+        k_work_reschedule_for_queue(&display_work_q, &display_update_work, K_NO_WAIT);
+    }
+}
+
+K_WORK_DEFINE(display_refresh_done_work, display_refresh_done_work_callback);
+
+// Busy interrupt, the rest of the refresh runs on the display queue
+static void display_refresh_done (const struct device *dev) {
+    k_work_submit_to_queue(&display_work_q, &display_refresh_done_work);
+}
+
+// Marks bindings as changed and schedules a render as soon as HDL accepts one
+static void display_mark_dirty (atomic_val_t mask) {
+    atomic_or(&dirty_bindings, mask);
+
+    if(!hdl_initialized) {
+        return;
+    }
+
+    int64_t wait = last_update_time + DISPLAY_MIN_UPDATE_MS - k_uptime_get();
+    k_ticks_t delay = wait > 0 ? k_ms_to_ticks_ceil64(wait) : 0;
+
+    // Only ever pull the pending render closer, never push it back
+    if(k_work_delayable_remaining_get(&display_update_work) > delay) {
+        k_work_reschedule_for_queue(&display_work_q, &display_update_work, K_TICKS(delay));
+    } else {
+        k_work_schedule_for_queue(&display_work_q, &display_update_work, K_TICKS(delay));
+    }
+}
+
+static int display_event_listener (const zmk_event_t *eh) {
+    #if IS_ENABLED(CONFIG_ZMK_WPM)
+    if(as_zmk_wpm_state_changed(eh) != NULL) {
+        display_mark_dirty(BIND_MASK(BIND_WPM));
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+    #endif
+
+    #if IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL) || !IS_ENABLED(CONFIG_ZMK_SPLIT)
+    if(as_zmk_layer_state_changed(eh) != NULL) {
+        display_mark_dirty(BIND_MASK(BIND_LAYER));
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+    #endif
+
+    #if IS_ENABLED(CONFIG_ZMK_SPLIT)
+    if(as_zmk_split_peripheral_status_changed(eh) != NULL) {
+        display_mark_dirty(BIND_MASK_SPLIT);
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+    #endif
+
+    #if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
+    if(as_zmk_usb_conn_state_changed(eh) != NULL) {
+        // Charging state and the USB endpoint both follow the cable
+        display_mark_dirty(BIND_MASK_BATTERY | BIND_MASK_CONNECTION);
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+    #endif
+
+    #if IS_ENABLED(CONFIG_ZMK_BLE)
+    if(as_zmk_battery_state_changed(eh) != NULL) {
+        display_mark_dirty(BIND_MASK_BATTERY);
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+    #endif
+
+    // BLE profile and endpoint selection
+    display_mark_dirty(BIND_MASK_CONNECTION);
+
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(hdl_display, display_event_listener);
+#if IS_ENABLED(CONFIG_ZMK_BLE)
+ZMK_SUBSCRIPTION(hdl_display, zmk_battery_state_changed);
+#endif
+#if IS_ENABLED(CONFIG_USB_DEVICE_STACK)
+ZMK_SUBSCRIPTION(hdl_display, zmk_usb_conn_state_changed);
+#endif
+#if IS_ENABLED(CONFIG_ZMK_WPM)
+ZMK_SUBSCRIPTION(hdl_display, zmk_wpm_state_changed);
+#endif
+#if IS_ENABLED(CONFIG_ZMK_SPLIT)
+ZMK_SUBSCRIPTION(hdl_display, zmk_split_peripheral_status_changed);
+#endif
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_ROLE_CENTRAL) || !IS_ENABLED(CONFIG_ZMK_SPLIT)
+ZMK_SUBSCRIPTION(hdl_display, zmk_layer_state_changed);
+ZMK_SUBSCRIPTION(hdl_display, zmk_endpoint_selection_changed);
+#if IS_ENABLED(CONFIG_ZMK_BLE)
+ZMK_SUBSCRIPTION(hdl_display, zmk_ble_active_profile_changed);
+#endif
+#endif
+
+static void display_start_work_callback(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(display_start_work, display_start_work_callback);
+
+static void display_start_work_callback(struct k_work *work) {
+    if(display == NULL) {
         display = DEVICE_DT_GET_ANY(gooddisplay_il0323n);
+        if(display == NULL) {
+            k_work_schedule_for_queue(&display_work_q, &display_start_work, K_MSEC(10000));
+            return;
+        }
     }
     // Initialize display registers
     il0323_init_regs(display);
@@ -384,30 +1039,10 @@ static void display_thread(void *arg, void *unused2, void *unused3) {
     interface.f_arc = dsp_arc;
 
     // Create bindings
-    HDL_SetBinding(&interface, "VIEW",          1, &dsp_binds.view, HDL_TYPE_I8);
-    HDL_SetBinding(&interface, "BATT_PERCENT",  2, &dsp_binds.batt_percent, HDL_TYPE_I8);
-    HDL_SetBinding(&interface, "BATT_SPRITE",   3, &dsp_binds.batt_sprite, HDL_TYPE_I8);
-    HDL_SetBinding(&interface, "CHRG",          4, &dsp_binds.charge, HDL_TYPE_BOOL);
-    HDL_SetBinding(&interface, "RSSI",          5, &dsp_binds.rssi, HDL_TYPE_I8);
-
-    HDL_SetBinding(&interface, "SENSITIVITY",   6, &dsp_binds.sensitivity, HDL_TYPE_I16);
-
-    HDL_SetBinding(&interface, "LAYER",         7, &dsp_binds.layer, HDL_TYPE_I8);
-    HDL_SetBinding(&interface, "BTPROFILE",     8, &dsp_binds.btProfile, HDL_TYPE_I8);
-    HDL_SetBinding(&interface, "SPLITCONNECTED", 9, &dsp_binds.splitConnected, HDL_TYPE_BOOL);
-    HDL_SetBinding(&interface, "WPM",   10,    &dsp_binds.wpm, HDL_TYPE_I16);
-    HDL_SetBinding(&interface, "CONNECTION_STATUS", 11, &dsp_binds.connectionStatus, HDL_TYPE_I8);
-    HDL_SetBinding(&interface, "HOST_DISCONNECTED", 12, &dsp_binds.hostDisconnected, HDL_TYPE_BOOL);
-
-    // Time and date
-    HDL_SetBinding(&interface, "HASTIME",       20, &dsp_binds.hasTime, HDL_TYPE_BOOL);
-    HDL_SetBinding(&interface, "HOURS",         21, &dsp_binds.hours, HDL_TYPE_I8);
-    HDL_SetBinding(&interface, "MINUTES",       22, &dsp_binds.minutes, HDL_TYPE_I8);
-    
-    HDL_SetBinding(&interface, "YEAR",          23, &dsp_binds.year, HDL_TYPE_I16);
-    HDL_SetBinding(&interface, "MONTH",         24, &dsp_binds.month, HDL_TYPE_I8);
-    HDL_SetBinding(&interface, "DAY",           25, &dsp_binds.day, HDL_TYPE_I8);
-    HDL_SetBinding(&interface, "WEEKDAY",       26, &dsp_binds.weekDay, HDL_TYPE_I8);
+    for(int i = 0; i < ARRAY_SIZE(dsp_bindings); i++) {
+        HDL_SetBinding(&interface, dsp_bindings[i].name, dsp_bindings[i].id, dsp_bindings[i].value,
+                       dsp_bindings[i].type);
+    }
 
     // Add preloaded images
     // Preloaded images' id's must have the MSb as 1 (>0x8000)
@@ -421,29 +1056,19 @@ static void display_thread(void *arg, void *unused2, void *unused3) {
     interface.textWidth = 5;
 
     // Set automatic update intervals
-    // min: 300ms, max: 30s
-    HDL_SetUpdateInterval(&interface, 300, 30000);
+    HDL_SetUpdateInterval(&interface, DISPLAY_MIN_UPDATE_MS, DISPLAY_IDLE_UPDATE_MS);
+
+    // Fill in every binding before the first build renders them
+    update_display_bindings(BIND_MASK_ALL);
 
     // Load data and build
     conf_display_updated();
 
     hdl_initialized = 1;
 
-    while(1) {
-
-        update_display_bindings();
-        k_mutex_lock(&hdl_mutex, K_FOREVER);
-        update_display_bindings();
-
-        if(HDL_Update(&interface, k_uptime_get()) > 0) {
-            il0323_hibernate(display);
-        }
-
-        k_mutex_unlock(&hdl_mutex);
-
-        // Sleep for 1sec
-        k_msleep(1000);
-    }
+    // Pick up anything that changed while building
+    display_mark_dirty(BIND_MASK_ALL);
+    display_poll_restart();
 }
 
 static int display_init () {
@@ -462,6 +1087,12 @@ static int display_init () {
     }
 
 #endif
+
+    // Renders run on their own queue, the HDL build and text rendering need a deep stack
+    k_work_queue_start(&display_work_q, hdl_display_work_stack,
+                       K_THREAD_STACK_SIZEOF(hdl_display_work_stack), K_PRIO_PREEMPT(10), NULL);
+    k_work_schedule_for_queue(&display_work_q, &display_start_work, K_MSEC(100));
+
     if (display == NULL) {
         LOG_ERR("Failed to get il0323n device");
         return -EINVAL;
@@ -481,4 +1112,3 @@ static int display_init () {
 }
 
 SYS_INIT(display_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
-K_THREAD_DEFINE(display_thr, 4096, display_thread, NULL, NULL, NULL, K_PRIO_PREEMPT(10), 0, 0);
\ No newline at end of file
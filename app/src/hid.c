@@ -26,6 +26,21 @@ static zmk_mod_flags_t explicit_modifiers = 0;
 static zmk_mod_flags_t implicit_modifiers = 0;
 static zmk_mod_flags_t masked_modifiers = 0;
 
+// Held usages with the implicit modifiers they were pressed with (e.g. LS(B)), oldest first.
+// The most recently pressed entry that is still held supplies the implicit modifiers, so
+// releasing LC(A) while LS(B) is held goes back to shift.
+#define IMPLICIT_MODIFIERS_MAX_USAGES 16
+
+struct implicit_modifiers_usage {
+    uint32_t usage;
+    zmk_mod_flags_t implicit_modifiers;
+    // Number of presses of this usage that are still held
+    int count;
+};
+
+static struct implicit_modifiers_usage implicit_modifiers_usages[IMPLICIT_MODIFIERS_MAX_USAGES];
+static int implicit_modifiers_usages_len = 0;
+
 #define SET_MODIFIERS(mods)                                                                        \
     {                                                                                              \
         keyboard_report.body.modifiers = (mods & ~masked_modifiers) | implicit_modifiers;          \
@@ -87,6 +102,57 @@ int zmk_hid_unregister_mods(zmk_mod_flags_t modifiers) {
     return ret;
 }
 
+// Pressed usages are kept in word-aligned bitmaps, so membership checks are a single bit test and
+// clearing the state is a handful of word writes regardless of the report type.
+#define USAGE_BITMAP_WORDS(max_usage) (((max_usage) / 32) + 1)
+#define USAGE_BIT_GET(bitmap, usage) ((bitmap[(usage) / 32] & BIT((usage) % 32)) != 0)
+#define USAGE_BIT_SET(bitmap, usage, val) WRITE_BIT(bitmap[(usage) / 32], (usage) % 32, val)
+
+static uint32_t keyboard_usages[USAGE_BITMAP_WORDS(0xFF)];
+static uint32_t consumer_usages[USAGE_BITMAP_WORDS(ZMK_HID_CONSUMER_MAX_USAGE)];
+
+// Held usages that didn't fit in a full report, in press order. The oldest one is promoted into
+// the report when a slot frees up.
+#define USAGE_OVERFLOW_MAX 16
+
+struct usage_overflow {
+    uint16_t usages[USAGE_OVERFLOW_MAX];
+    int len;
+};
+
+static int usage_overflow_push(struct usage_overflow *overflow, uint16_t usage) {
+    if (overflow->len == USAGE_OVERFLOW_MAX) {
+        LOG_WRN("Too many held back usages, 0x%02X won't be reported", usage);
+        return -ENOMEM;
+    }
+    overflow->usages[overflow->len++] = usage;
+    return 0;
+}
+
+static bool usage_overflow_remove(struct usage_overflow *overflow, uint16_t usage) {
+    for (int i = 0; i < overflow->len; i++) {
+        if (overflow->usages[i] == usage) {
+            memmove(&overflow->usages[i], &overflow->usages[i + 1],
+                    (overflow->len - i - 1) * sizeof(overflow->usages[0]));
+            overflow->len--;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns the oldest held back usage, or 0 if there is none
+static uint16_t usage_overflow_pop(struct usage_overflow *overflow) {
+    if (overflow->len == 0) {
+        return 0;
+    }
+    uint16_t usage = overflow->usages[0];
+    usage_overflow_remove(overflow, usage);
+    return usage;
+}
+
+static struct usage_overflow consumer_overflow;
+
 #if IS_ENABLED(CONFIG_ZMK_HID_REPORT_TYPE_NKRO)
 
 #define TOGGLE_KEYBOARD(code, val) WRITE_BIT(keyboard_report.body.keys[code / 8], code % 8, val)
@@ -95,6 +161,7 @@ static inline int select_keyboard_usage(zmk_key_t usage) {
     if (usage > ZMK_HID_KEYBOARD_NKRO_MAX_USAGE) {
         return -EINVAL;
     }
+    USAGE_BIT_SET(keyboard_usages, usage, 1);
     TOGGLE_KEYBOARD(usage, 1);
     return 0;
 }
@@ -103,75 +170,118 @@ static inline int deselect_keyboard_usage(zmk_key_t usage) {
     if (usage > ZMK_HID_KEYBOARD_NKRO_MAX_USAGE) {
         return -EINVAL;
     }
+    USAGE_BIT_SET(keyboard_usages, usage, 0);
     TOGGLE_KEYBOARD(usage, 0);
     return 0;
 }
 
-static inline bool check_keyboard_usage(zmk_key_t usage) {
-    if (usage > ZMK_HID_KEYBOARD_NKRO_MAX_USAGE) {
-        return false;
-    }
-    return keyboard_report.body.keys[usage / 8] & (1 << (usage % 8));
-}
-
 #elif IS_ENABLED(CONFIG_ZMK_HID_REPORT_TYPE_HKRO)
 
-#define TOGGLE_KEYBOARD(match, val)                                                                \
-    for (int idx = 0; idx < CONFIG_ZMK_HID_KEYBOARD_REPORT_SIZE; idx++) {                          \
-        if (keyboard_report.body.keys[idx] != match) {                                             \
-            continue;                                                                              \
-        }                                                                                          \
-        keyboard_report.body.keys[idx] = val;                                                      \
-        if (val) {                                                                                 \
-            break;                                                                                 \
-        }                                                                                          \
-    }
+static struct usage_overflow keyboard_overflow;
 
 static inline int select_keyboard_usage(zmk_key_t usage) {
-    TOGGLE_KEYBOARD(0U, usage);
+    if (usage > 0xFF) {
+        return -EINVAL;
+    }
+    if (USAGE_BIT_GET(keyboard_usages, usage)) {
+        return 0;
+    }
+    USAGE_BIT_SET(keyboard_usages, usage, 1);
+
+    // Slots are filled in press order
+    for (int idx = 0; idx < CONFIG_ZMK_HID_KEYBOARD_REPORT_SIZE; idx++) {
+        if (keyboard_report.body.keys[idx] == 0U) {
+            keyboard_report.body.keys[idx] = usage;
+            return 0;
+        }
+    }
+
+    LOG_DBG("Keyboard report full, holding back usage 0x%02X", usage);
+    usage_overflow_push(&keyboard_overflow, usage);
     return 0;
 }
 
 static inline int deselect_keyboard_usage(zmk_key_t usage) {
-    TOGGLE_KEYBOARD(usage, 0U);
-    return 0;
-}
+    if (usage > 0xFF || !USAGE_BIT_GET(keyboard_usages, usage)) {
+        return 0;
+    }
+    USAGE_BIT_SET(keyboard_usages, usage, 0);
 
-static inline int check_keyboard_usage(zmk_key_t usage) {
     for (int idx = 0; idx < CONFIG_ZMK_HID_KEYBOARD_REPORT_SIZE; idx++) {
         if (keyboard_report.body.keys[idx] == usage) {
-            return true;
+            keyboard_report.body.keys[idx] = usage_overflow_pop(&keyboard_overflow);
+            return 0;
         }
     }
-    return false;
+
+    // Not in the report, so it was one of the held back usages
+    usage_overflow_remove(&keyboard_overflow, usage);
+    return 0;
 }
 
 #else
 #error "A proper HID report type must be selected"
 #endif
 
-#define TOGGLE_CONSUMER(match, val)                                                                \
-    COND_CODE_1(IS_ENABLED(CONFIG_ZMK_HID_CONSUMER_REPORT_USAGES_BASIC),                           \
-                (if (val > 0xFF) { return -ENOTSUP; }), ())                                        \
-    for (int idx = 0; idx < CONFIG_ZMK_HID_CONSUMER_REPORT_SIZE; idx++) {                          \
-        if (consumer_report.body.keys[idx] != match) {                                             \
-            continue;                                                                              \
-        }                                                                                          \
-        consumer_report.body.keys[idx] = val;                                                      \
-        if (val) {                                                                                 \
-            break;                                                                                 \
-        }                                                                                          \
-    }
-
-int zmk_hid_implicit_modifiers_press(zmk_mod_flags_t new_implicit_modifiers) {
-    implicit_modifiers = new_implicit_modifiers;
+static inline bool check_keyboard_usage(zmk_key_t usage) {
+    if (usage > 0xFF) {
+        return false;
+    }
+    return USAGE_BIT_GET(keyboard_usages, usage);
+}
+
+static int find_implicit_modifiers_usage(uint32_t usage) {
+    for (int i = implicit_modifiers_usages_len - 1; i >= 0; i--) {
+        if (implicit_modifiers_usages[i].usage == usage) {
+            return i;
+        }
+    }
+    return -ENOENT;
+}
+
+static void remove_implicit_modifiers_usage(int idx) {
+    memmove(&implicit_modifiers_usages[idx], &implicit_modifiers_usages[idx + 1],
+            (implicit_modifiers_usages_len - idx - 1) * sizeof(implicit_modifiers_usages[0]));
+    implicit_modifiers_usages_len--;
+}
+
+static void update_implicit_modifiers() {
+    implicit_modifiers =
+        implicit_modifiers_usages_len > 0
+            ? implicit_modifiers_usages[implicit_modifiers_usages_len - 1].implicit_modifiers
+            : 0;
+}
+
+int zmk_hid_implicit_modifiers_press(uint32_t usage, zmk_mod_flags_t new_implicit_modifiers) {
+    int idx = find_implicit_modifiers_usage(usage);
+    int count = 1;
+
+    // A repeated press moves the usage to the end, it is now the most recent one
+    if (idx >= 0) {
+        count += implicit_modifiers_usages[idx].count;
+        remove_implicit_modifiers_usage(idx);
+    } else if (implicit_modifiers_usages_len == IMPLICIT_MODIFIERS_MAX_USAGES) {
+        LOG_WRN("Too many held usages with implicit modifiers, forgetting the oldest");
+        remove_implicit_modifiers_usage(0);
+    }
+
+    implicit_modifiers_usages[implicit_modifiers_usages_len++] =
+        (struct implicit_modifiers_usage){
+            .usage = usage, .implicit_modifiers = new_implicit_modifiers, .count = count};
+
+    update_implicit_modifiers();
     zmk_mod_flags_t current = GET_MODIFIERS;
     SET_MODIFIERS(explicit_modifiers);
     return current == GET_MODIFIERS ? 0 : 1;
 }
 
-int zmk_hid_implicit_modifiers_release() {
-    implicit_modifiers = 0;
+int zmk_hid_implicit_modifiers_release(uint32_t usage) {
+    int idx = find_implicit_modifiers_usage(usage);
+    if (idx >= 0 && --implicit_modifiers_usages[idx].count <= 0) {
+        remove_implicit_modifiers_usage(idx);
+    }
+
+    update_implicit_modifiers();
     zmk_mod_flags_t current = GET_MODIFIERS;
     SET_MODIFIERS(explicit_modifiers);
     return current == GET_MODIFIERS ? 0 : 1;
@@ -214,27 +324,63 @@ bool zmk_hid_keyboard_is_pressed(zmk_key_t code) {
     return check_keyboard_usage(code);
 }
 
-void zmk_hid_keyboard_clear() { memset(&keyboard_report.body, 0, sizeof(keyboard_report.body)); }
+void zmk_hid_keyboard_clear() {
+    memset(keyboard_usages, 0, sizeof(keyboard_usages));
+#if IS_ENABLED(CONFIG_ZMK_HID_REPORT_TYPE_HKRO)
+    keyboard_overflow.len = 0;
+#endif
+    memset(&keyboard_report.body, 0, sizeof(keyboard_report.body));
+}
 
 int zmk_hid_consumer_press(zmk_key_t code) {
-    TOGGLE_CONSUMER(0U, code);
+    if (code > ZMK_HID_CONSUMER_MAX_USAGE) {
+        return -ENOTSUP;
+    }
+    if (USAGE_BIT_GET(consumer_usages, code)) {
+        return 0;
+    }
+    USAGE_BIT_SET(consumer_usages, code, 1);
+
+    for (int idx = 0; idx < CONFIG_ZMK_HID_CONSUMER_REPORT_SIZE; idx++) {
+        if (consumer_report.body.keys[idx] == 0U) {
+            consumer_report.body.keys[idx] = code;
+            return 0;
+        }
+    }
+
+    LOG_DBG("Consumer report full, holding back usage 0x%02X", code);
+    usage_overflow_push(&consumer_overflow, code);
     return 0;
 };
 
 int zmk_hid_consumer_release(zmk_key_t code) {
-    TOGGLE_CONSUMER(code, 0U);
+    if (code > ZMK_HID_CONSUMER_MAX_USAGE || !USAGE_BIT_GET(consumer_usages, code)) {
+        return 0;
+    }
+    USAGE_BIT_SET(consumer_usages, code, 0);
+
+    for (int idx = 0; idx < CONFIG_ZMK_HID_CONSUMER_REPORT_SIZE; idx++) {
+        if (consumer_report.body.keys[idx] == code) {
+            consumer_report.body.keys[idx] = usage_overflow_pop(&consumer_overflow);
+            return 0;
+        }
+    }
+
+    usage_overflow_remove(&consumer_overflow, code);
     return 0;
 };
 
-void zmk_hid_consumer_clear() { memset(&consumer_report.body, 0, sizeof(consumer_report.body)); }
+void zmk_hid_consumer_clear() {
+    memset(consumer_usages, 0, sizeof(consumer_usages));
+    consumer_overflow.len = 0;
+    memset(&consumer_report.body, 0, sizeof(consumer_report.body));
+}
 
 bool zmk_hid_consumer_is_pressed(zmk_key_t key) {
-    for (int idx = 0; idx < CONFIG_ZMK_HID_CONSUMER_REPORT_SIZE; idx++) {
-        if (consumer_report.body.keys[idx] == key) {
-            return true;
-        }
+    if (key > ZMK_HID_CONSUMER_MAX_USAGE) {
+        return false;
     }
-    return false;
+    return USAGE_BIT_GET(consumer_usages, key);
 }
 
 int zmk_hid_press(uint32_t usage) {
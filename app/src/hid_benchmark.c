@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2022 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Mock HID endpoint used by run-benchmark.sh. Key scan events and HID report submissions are
+ * timestamped and logged as CSV records, which the script pairs up to compute latency and
+ * throughput.
+ */
+
+#include <zephyr.h>
+#include <logging/log.h>
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/hid_benchmark.h>
+
+static atomic_t kscan_seq = ATOMIC_INIT(0);
+static atomic_t report_seq = ATOMIC_INIT(0);
+
+static inline uint32_t benchmark_timestamp_us() { return k_cyc_to_us_floor32(k_cycle_get_32()); }
+
+void zmk_hid_benchmark_kscan_event(uint32_t row, uint32_t column, bool pressed) {
+    uint32_t timestamp = benchmark_timestamp_us();
+
+    LOG_INF("bench,kscan,%d,%u,%u,%u,%d", (int)atomic_inc(&kscan_seq), timestamp, row, column,
+            pressed);
+}
+
+int zmk_hid_benchmark_send_report(const uint8_t *report, size_t len) {
+    uint32_t timestamp = benchmark_timestamp_us();
+
+    LOG_INF("bench,report,%d,%u,0x%02X,%zu,0", (int)atomic_inc(&report_seq), timestamp, report[0],
+            len);
+    return 0;
+}
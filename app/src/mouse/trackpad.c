@@ -11,11 +11,14 @@
 #include <device.h>
 #include <init.h>
 #include <drivers/sensor.h>
+#if IS_ENABLED(CONFIG_IQS5XX)
 #include <iqs5xx.h>
+#endif
 #include <logging/log.h>
 #include <devicetree.h>
 #include <math.h>
 #include <zmk/config.h>
+#include <zmk/trackpad.h>
 
 LOG_MODULE_DECLARE(azoteq_iqs5xx, CONFIG_ZMK_LOG_LEVEL);
 
@@ -35,7 +38,9 @@ static bool isHolding = false;
 
 //LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
+#if IS_ENABLED(CONFIG_IQS5XX)
 static const struct device *trackpad;
+#endif
 
 // Input active flag
 static bool inputEventActive = false;
@@ -52,13 +57,14 @@ static bool threeFingersPressed = false;
 
 static uint8_t mouseSensitivity = 128;
 
-struct iqs5xx_reg_config trackpad_registers;
-
 struct {
     float x;
     float y;
 } accumPos;
 
+#if IS_ENABLED(CONFIG_IQS5XX)
+struct iqs5xx_reg_config trackpad_registers;
+
 /**
  * @brief Called when `trackpad_registers` is updated via zmk_control/zmk_config
  * 
@@ -71,6 +77,7 @@ void trackpad_config_on_update (struct zmk_config_field *field) {
         LOG_ERR("Failed to refresh IQS5xx registers!\r\n");
     }
 }
+#endif
 
 struct k_timer leftclick_release_timer;
 static void trackpad_leftclick_release () {
@@ -140,8 +147,7 @@ static inline void trackpad_tap_and_hold(bool g) {
 
 
 
-// Sensor trigger handler
-static void trackpad_trigger_handler(const struct device *dev, const struct iqs5xx_rawdata *data) {
+void zmk_trackpad_process(const struct zmk_trackpad_data *data) {
 
 
     bool multiTouch = false;
@@ -175,19 +181,17 @@ static void trackpad_trigger_handler(const struct device *dev, const struct iqs5
     }
 
     // Check if any gesture exists
-    if((data->gestures0 || data->gestures1) && !hasGesture) {
-        switch(data->gestures1) {
-            case GESTURE_TWO_FINGER_TAP:
+    if(data->gestures && !hasGesture) {
+        if(data->gestures & ZMK_TRACKPAD_GESTURE_TWO_FINGER_TAP) {
                 hasGesture = true;
                 // Right click
                 trackpad_rightclick();
                 zmk_hid_mouse_movement_set(0,0);
-                break;                   
-            case GESTURE_SCROLLG:
+        } else if(data->gestures & ZMK_TRACKPAD_GESTURE_SCROLL) {
                 hasGesture = true;
-                lastXScrollReport += data->rx;
+                lastXScrollReport += data->dx;
                 // Pan can be always reported
-                int8_t pan = -data->ry;
+                int8_t pan = -data->dy;
                 // Report scroll only if a certain distance has been travelled
                 int8_t scroll = 0;
                 if(abs(lastXScrollReport) - (int16_t)SCROLL_REPORT_DISTANCE > 0) {
@@ -197,16 +201,13 @@ static void trackpad_trigger_handler(const struct device *dev, const struct iqs5
                 zmk_hid_mouse_scroll_set(pan, scroll);
                 zmk_hid_mouse_movement_set(0,0);
                 //k_msleep(10);
-                break;
         }
-        switch(data->gestures0) {
-            case GESTURE_SINGLE_TAP:
+        if(data->gestures & ZMK_TRACKPAD_GESTURE_SINGLE_TAP) {
                 // Left click
                 hasGesture = true;
                 trackpad_leftclick();
                 zmk_hid_mouse_movement_set(0,0);
-                break;
-            case GESTURE_TAP_AND_HOLD:
+        } else if(data->gestures & ZMK_TRACKPAD_GESTURE_TAP_AND_HOLD) {
                 //drag n drop
                 trackpad_tap_and_hold(true);
                 zmk_hid_mouse_movement_set(0,0);
@@ -222,8 +223,8 @@ static void trackpad_trigger_handler(const struct device *dev, const struct iqs5
         // No gesture, can send mouse delta position
         if(data->finger_count == 1) {
             float sensMp = (float)mouseSensitivity/128.0F;
-            accumPos.x += -data->ry * sensMp;
-            accumPos.y += data->rx * sensMp;
+            accumPos.x += -data->dy * sensMp;
+            accumPos.y += data->dx * sensMp;
             int16_t xp = accumPos.x;
             int16_t yp = accumPos.y;
 
@@ -251,17 +252,39 @@ static void trackpad_trigger_handler(const struct device *dev, const struct iqs5
     }
 }
 
+#if IS_ENABLED(CONFIG_IQS5XX)
+// Sensor trigger handler
+static void trackpad_trigger_handler(const struct device *dev, const struct iqs5xx_rawdata *data) {
+    struct zmk_trackpad_data trackpad_data = {
+        .dx = data->rx,
+        .dy = data->ry,
+        .finger_count = data->finger_count,
+        .gestures = ZMK_TRACKPAD_GESTURES(data->gestures0, data->gestures1),
+    };
+    zmk_trackpad_process(&trackpad_data);
+}
+#endif
+
 static int trackpad_init(const struct device *_arg) {
+    accumPos.x = 0;
+    accumPos.y = 0;
+
+#if IS_ENABLED(CONFIG_IQS5XX)
     trackpad = DEVICE_DT_GET_ANY(azoteq_iqs5xx);
     if (trackpad == NULL) {
         LOG_ERR("Failed to get IQS5XX device");
         return -EINVAL;
     }
+#else
+    // Motion only arrives from a split peripheral
+    const struct device *trackpad = NULL;
+#endif
     // Bind mouse sensitivity
     if(zmk_config_bind(ZMK_CONFIG_KEY_MOUSE_SENSITIVITY, &mouseSensitivity, sizeof(mouseSensitivity), true, NULL, trackpad) == NULL) {
         LOG_ERR("Failed to bind mouse sensitivity");
     }
 
+#if IS_ENABLED(CONFIG_IQS5XX)
     // Initialize default registers, will be overwritten if saved
     trackpad_registers = iqs5xx_reg_config_default();
     // Bind config - mark saveable
@@ -269,15 +292,13 @@ static int trackpad_init(const struct device *_arg) {
         LOG_ERR("Failed to bind trackpad config");
     }
     
-    accumPos.x = 0;
-    accumPos.y = 0;
-
     int err = 0;
     err = iqs5xx_trigger_set(trackpad, trackpad_trigger_handler);
     if(err) {
         
         return -EINVAL;
     }
+#endif
 
     return 0;
 }
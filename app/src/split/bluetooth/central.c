@@ -23,13 +23,42 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/sensors.h>
 #include <zmk/split/bluetooth/uuid.h>
 #include <zmk/split/bluetooth/service.h>
+#include <zmk/split/bluetooth/central.h>
+#include <zmk/split/central.h>
 #include <zmk/event_manager.h>
 #include <zmk/events/position_state_changed.h>
 #include <zmk/events/sensor_event.h>
+#include <zmk/events/activity_state_changed.h>
+#include <zmk/events/split_peripheral_status_changed.h>
+#include <zmk/trackpad.h>
 #include <init.h>
 
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_HANDLE_CACHE)
+#include <stdio.h>
+#include <stdlib.h>
+#include <settings/settings.h>
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_CONFIG)
+#include <zmk/config.h>
+#endif
+
 static int start_scan(void);
 
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_DYNAMIC_CONN_PARAMS)
+#define SPLIT_ACTIVE_CONN_PARAM                                                                    \
+    BT_LE_CONN_PARAM(CONFIG_ZMK_SPLIT_BLE_ACTIVE_CONN_INTERVAL,                                    \
+                     CONFIG_ZMK_SPLIT_BLE_ACTIVE_CONN_INTERVAL,                                    \
+                     CONFIG_ZMK_SPLIT_BLE_ACTIVE_CONN_LATENCY,                                     \
+                     CONFIG_ZMK_SPLIT_BLE_ACTIVE_CONN_TIMEOUT)
+#define SPLIT_IDLE_CONN_PARAM                                                                      \
+    BT_LE_CONN_PARAM(CONFIG_ZMK_SPLIT_BLE_IDLE_CONN_INTERVAL,                                      \
+                     CONFIG_ZMK_SPLIT_BLE_IDLE_CONN_INTERVAL,                                      \
+                     CONFIG_ZMK_SPLIT_BLE_IDLE_CONN_LATENCY, CONFIG_ZMK_SPLIT_BLE_IDLE_CONN_TIMEOUT)
+#else
+#define SPLIT_ACTIVE_CONN_PARAM BT_LE_CONN_PARAM(0x0006, 0x0006, 30, 400)
+#endif
+
 #define POSITION_STATE_DATA_LEN 16
 
 enum peripheral_slot_state {
@@ -38,13 +67,57 @@ enum peripheral_slot_state {
     PERIPHERAL_SLOT_STATE_CONNECTED,
 };
 
+struct split_clock {
+    bool valid;
+    bool pending;
+    // Peripheral minus central uptime, as of last_sync_us
+    int64_t offset_us;
+    int32_t drift_ppm;
+    int64_t last_sync_us;
+    uint32_t best_rtt_us;
+    int64_t request_us;
+};
+
 struct peripheral_slot {
     enum peripheral_slot_state state;
     struct bt_conn *conn;
     struct bt_gatt_discover_params discover_params;
     struct bt_gatt_subscribe_params subscribe_params;
     struct bt_gatt_discover_params sub_discover_params;
+    struct bt_gatt_subscribe_params event_log_subscribe_params;
+    struct bt_gatt_discover_params event_log_sub_discover_params;
+    struct bt_gatt_subscribe_params motion_subscribe_params;
+    struct bt_gatt_discover_params motion_sub_discover_params;
+    struct bt_gatt_read_params resync_params;
+    struct bt_gatt_read_params clock_params;
+    uint16_t position_state_handle;
     uint16_t run_behavior_handle;
+    uint16_t run_behavior_batch_handle;
+    // Set once the peripheral reported that its behavior IDs are unique, batches are used only then
+    bool run_behavior_batch_ok;
+    struct bt_gatt_read_params batch_status_params;
+    uint16_t time_sync_handle;
+    struct split_clock clock;
+    bool resync_pending;
+    // Set when the handles came from the cache and the database hash hasn't been checked yet
+    bool handles_cached;
+    bool db_hash_pending;
+    struct bt_gatt_read_params db_hash_params;
+    // Set once the first event log notification has been received
+    bool seq_valid;
+    uint8_t expected_seq;
+    int64_t last_timestamp;
+#if ZMK_KEYMAP_HAS_SENSORS
+    struct bt_gatt_subscribe_params sensor_subscribe_params;
+    struct bt_gatt_discover_params sensor_sub_discover_params;
+#endif /* ZMK_KEYMAP_HAS_SENSORS */
+    // Each peripheral queues its own events so a burst from one can't push out another's
+    struct k_msgq event_msgq;
+    char __aligned(4) event_msgq_buffer[CONFIG_ZMK_SPLIT_BLE_CENTRAL_POSITION_QUEUE_SIZE *
+                                        sizeof(struct zmk_position_state_changed)];
+    struct k_msgq motion_msgq;
+    char __aligned(4) motion_msgq_buffer[CONFIG_ZMK_SPLIT_BLE_CENTRAL_POSITION_QUEUE_SIZE *
+                                         sizeof(struct zmk_trackpad_data)];
     uint8_t position_state[POSITION_STATE_DATA_LEN];
     uint8_t changed_positions[POSITION_STATE_DATA_LEN];
 };
@@ -53,14 +126,31 @@ static bool is_connected = false;
 
 static struct peripheral_slot peripherals[ZMK_BLE_SPLIT_PERIPHERAL_COUNT];
 
-static const struct bt_uuid_128 split_service_uuid = BT_UUID_INIT_128(ZMK_SPLIT_BT_SERVICE_UUID);
+// Kept apart from the slots so the counters survive reconnects
+static struct zmk_split_link_stats link_stats[ZMK_BLE_SPLIT_PERIPHERAL_COUNT];
 
-K_MSGQ_DEFINE(peripheral_event_msgq, sizeof(struct zmk_position_state_changed),
-              CONFIG_ZMK_SPLIT_BLE_CENTRAL_POSITION_QUEUE_SIZE, 4);
+static const struct bt_uuid_128 split_service_uuid = BT_UUID_INIT_128(ZMK_SPLIT_BT_SERVICE_UUID);
 
 void peripheral_event_work_callback(struct k_work *work) {
     struct zmk_position_state_changed ev;
-    while (k_msgq_get(&peripheral_event_msgq, &ev, K_NO_WAIT) == 0) {
+
+    // Merge the peripheral queues, oldest event first
+    while (true) {
+        int next = -1;
+        int64_t next_timestamp = 0;
+
+        for (int i = 0; i < ZMK_BLE_SPLIT_PERIPHERAL_COUNT; i++) {
+            if (k_msgq_peek(&peripherals[i].event_msgq, &ev) == 0 &&
+                (next < 0 || ev.timestamp < next_timestamp)) {
+                next = i;
+                next_timestamp = ev.timestamp;
+            }
+        }
+
+        if (next < 0 || k_msgq_get(&peripherals[next].event_msgq, &ev, K_NO_WAIT) != 0) {
+            break;
+        }
+
         LOG_DBG("Trigger key position state change for %d", ev.position);
         ZMK_EVENT_RAISE(new_zmk_position_state_changed(ev));
     }
@@ -68,6 +158,30 @@ void peripheral_event_work_callback(struct k_work *work) {
 
 K_WORK_DEFINE(peripheral_event_work, peripheral_event_work_callback);
 
+static void split_central_request_resync(struct bt_conn *conn, struct peripheral_slot *slot);
+
+static void queue_position_event(uint8_t source, uint32_t position, bool pressed,
+                                 int64_t timestamp) {
+    struct peripheral_slot *slot = &peripherals[source];
+    struct zmk_position_state_changed ev = {
+        .source = source, .position = position, .state = pressed, .timestamp = timestamp};
+
+    int err = k_msgq_put(&slot->event_msgq, &ev, K_NO_WAIT);
+    if (err) {
+        LOG_WRN("Event queue for peripheral %d full, dropping position %d", source, position);
+        link_stats[source].dropped_events++;
+
+        // Forget the change so the next full state read raises it again instead of leaving the
+        // key stuck
+        WRITE_BIT(slot->position_state[position / 8], position % 8, !pressed);
+        if (slot->state == PERIPHERAL_SLOT_STATE_CONNECTED) {
+            split_central_request_resync(slot->conn, slot);
+        }
+    }
+
+    k_work_submit(&peripheral_event_work);
+}
+
 int peripheral_slot_index_for_conn(struct bt_conn *conn) {
     for (int i = 0; i < ZMK_BLE_SPLIT_PERIPHERAL_COUNT; i++) {
         if (peripherals[i].conn == conn) {
@@ -105,19 +219,14 @@ int release_peripheral_slot(int index) {
         slot->conn = NULL;
     }
     slot->state = PERIPHERAL_SLOT_STATE_OPEN;
+    link_stats[index].connected = false;
+    link_stats[index].rssi = 0;
 
     // Raise events releasing any active positions from this peripheral
     for (int i = 0; i < POSITION_STATE_DATA_LEN; i++) {
         for (int j = 0; j < 8; j++) {
             if (slot->position_state[i] & BIT(j)) {
-                uint32_t position = (i * 8) + j;
-                struct zmk_position_state_changed ev = {.source = index,
-                                                        .position = position,
-                                                        .state = false,
-                                                        .timestamp = k_uptime_get()};
-
-                k_msgq_put(&peripheral_event_msgq, &ev, K_NO_WAIT);
-                k_work_submit(&peripheral_event_work);
+                queue_position_event(index, (i * 8) + j, false, k_uptime_get());
             }
         }
     }
@@ -129,7 +238,27 @@ int release_peripheral_slot(int index) {
 
     // Clean up previously discovered handles;
     slot->subscribe_params.value_handle = 0;
+    slot->subscribe_params.ccc_handle = 0;
+    slot->event_log_subscribe_params.value_handle = 0;
+    slot->event_log_subscribe_params.ccc_handle = 0;
+    slot->motion_subscribe_params.value_handle = 0;
+    slot->motion_subscribe_params.ccc_handle = 0;
+#if ZMK_KEYMAP_HAS_SENSORS
+    slot->sensor_subscribe_params.value_handle = 0;
+    slot->sensor_subscribe_params.ccc_handle = 0;
+#endif /* ZMK_KEYMAP_HAS_SENSORS */
+    slot->position_state_handle = 0;
     slot->run_behavior_handle = 0;
+    slot->run_behavior_batch_handle = 0;
+    slot->run_behavior_batch_ok = false;
+    slot->time_sync_handle = 0;
+    slot->clock = (struct split_clock){0};
+
+    slot->resync_pending = false;
+    slot->handles_cached = false;
+    slot->db_hash_pending = false;
+    slot->seq_valid = false;
+    slot->last_timestamp = 0;
 
     return 0;
 }
@@ -163,9 +292,214 @@ int confirm_peripheral_slot_conn(struct bt_conn *conn) {
     }
 
     peripherals[idx].state = PERIPHERAL_SLOT_STATE_CONNECTED;
+    link_stats[idx].connected = true;
     return 0;
 }
 
+static int64_t uptime_us(void) { return k_ticks_to_us_floor64(k_uptime_ticks()); }
+
+static int64_t split_clock_offset_at(const struct split_clock *clock, int64_t central_us) {
+    return clock->offset_us + clock->drift_ppm * (central_us - clock->last_sync_us) / 1000000;
+}
+
+// Translates a 32 bit peripheral timestamp from around now_us into central uptime
+static int64_t split_clock_to_central_us(const struct split_clock *clock, uint32_t peripheral_us,
+                                         int64_t now_us) {
+    int64_t offset_us = split_clock_offset_at(clock, now_us);
+    int64_t peripheral_now_us = now_us + offset_us;
+
+    return peripheral_now_us + (int32_t)(peripheral_us - (uint32_t)peripheral_now_us) - offset_us;
+}
+
+// Translates a 32 bit peripheral timestamp into central uptime in milliseconds
+static int64_t split_central_peripheral_timestamp(struct peripheral_slot *slot,
+                                                  uint32_t peripheral_us, int64_t fallback) {
+    if (!IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_CLOCK_SYNC) || !slot->clock.valid) {
+        return fallback;
+    }
+
+    int64_t now_us = uptime_us();
+    int64_t central_us = split_clock_to_central_us(&slot->clock, peripheral_us, now_us);
+
+    // The event can't have happened after it was received
+    return MIN(central_us, now_us) / 1000;
+}
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_CLOCK_SYNC)
+
+#define CLOCK_SYNC_MAX_DRIFT_PPM 500
+
+static void split_clock_update(struct split_clock *clock, int64_t request_us, int64_t response_us,
+                               uint32_t peripheral_us) {
+    uint32_t rtt_us = response_us - request_us;
+    // Assume the peripheral sampled its clock half way through the round trip
+    int64_t midpoint_us = request_us + rtt_us / 2;
+
+    if (!clock->valid) {
+        // Only the low 32 bits of peripheral time are ever compared, so the first sample anchors
+        // the peripheral timeline.
+        clock->offset_us = (int64_t)peripheral_us - midpoint_us;
+        clock->drift_ppm = 0;
+        clock->last_sync_us = midpoint_us;
+        clock->best_rtt_us = rtt_us;
+        clock->valid = true;
+        return;
+    }
+
+    uint32_t best_rtt_us = clock->best_rtt_us;
+    if (rtt_us < best_rtt_us) {
+        clock->best_rtt_us = rtt_us;
+    } else {
+        // Creep upwards so a longer connection interval is eventually accepted
+        clock->best_rtt_us += (rtt_us - best_rtt_us) / 8;
+    }
+
+    // Slow round trips were delayed somewhere and give a poor midpoint estimate
+    if (rtt_us > 2 * best_rtt_us) {
+        LOG_DBG("Discarding clock sample with RTT %d us", rtt_us);
+        return;
+    }
+
+    int64_t predicted_us = split_clock_offset_at(clock, midpoint_us);
+    int32_t error_us = peripheral_us - (uint32_t)(midpoint_us + predicted_us);
+    int64_t elapsed_us = midpoint_us - clock->last_sync_us;
+
+    if (elapsed_us > 0) {
+        int32_t drift_ppm = clock->drift_ppm + ((int64_t)error_us * 1000000 / elapsed_us) / 4;
+        clock->drift_ppm = CLAMP(drift_ppm, -CLOCK_SYNC_MAX_DRIFT_PPM, CLOCK_SYNC_MAX_DRIFT_PPM);
+    }
+
+    clock->offset_us = predicted_us + error_us / 2;
+    clock->last_sync_us = midpoint_us;
+
+    LOG_DBG("Clock error %d us, drift %d ppm, RTT %d us", error_us, clock->drift_ppm, rtt_us);
+}
+
+static uint8_t split_central_clock_read_func(struct bt_conn *conn, uint8_t err,
+                                             struct bt_gatt_read_params *params, const void *data,
+                                             uint16_t length) {
+    int64_t response_us = uptime_us();
+    struct peripheral_slot *slot = peripheral_slot_for_conn(conn);
+
+    if (slot == NULL) {
+        LOG_ERR("No peripheral state found for connection");
+        return BT_GATT_ITER_STOP;
+    }
+
+    slot->clock.pending = false;
+
+    if (err) {
+        LOG_ERR("Failed to read peripheral clock (err %d)", err);
+        return BT_GATT_ITER_STOP;
+    }
+
+    if (!data || length < sizeof(uint32_t)) {
+        LOG_ERR("Invalid peripheral clock read (length %u)", length);
+        return BT_GATT_ITER_STOP;
+    }
+
+    split_clock_update(&slot->clock, slot->clock.request_us, response_us,
+                       sys_get_le32((const uint8_t *)data));
+
+    return BT_GATT_ITER_STOP;
+}
+
+static void split_central_clock_sync_work_callback(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(split_central_clock_sync_work, split_central_clock_sync_work_callback);
+
+static void split_central_clock_sync_work_callback(struct k_work *work) {
+    bool any_connected = false;
+    bool all_valid = true;
+
+    for (int i = 0; i < ZMK_BLE_SPLIT_PERIPHERAL_COUNT; i++) {
+        struct peripheral_slot *slot = &peripherals[i];
+
+        if (slot->state != PERIPHERAL_SLOT_STATE_CONNECTED || !slot->time_sync_handle) {
+            continue;
+        }
+
+        any_connected = true;
+        if (slot->clock.pending) {
+            continue;
+        }
+
+        slot->clock_params.func = split_central_clock_read_func;
+        slot->clock_params.handle_count = 1;
+        slot->clock_params.single.handle = slot->time_sync_handle;
+        slot->clock_params.single.offset = 0;
+        slot->clock.request_us = uptime_us();
+
+        int err = bt_gatt_read(slot->conn, &slot->clock_params);
+        if (err) {
+            LOG_ERR("Failed to request peripheral clock (err %d)", err);
+            continue;
+        }
+
+        slot->clock.pending = true;
+        all_valid &= slot->clock.valid;
+    }
+
+    // Finding the time sync characteristic of the next peripheral starts this again
+    if (!any_connected) {
+        return;
+    }
+
+    // Get a first estimate quickly after connecting, then settle into the sync interval
+    k_work_schedule(&split_central_clock_sync_work,
+                    all_valid ? K_MSEC(CONFIG_ZMK_SPLIT_BLE_CENTRAL_CLOCK_SYNC_INTERVAL)
+                              : K_MSEC(250));
+}
+
+#endif /* IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_CLOCK_SYNC) */
+
+void peripheral_motion_work_callback(struct k_work *work) {
+    struct zmk_trackpad_data data;
+    for (int i = 0; i < ZMK_BLE_SPLIT_PERIPHERAL_COUNT; i++) {
+        while (k_msgq_get(&peripherals[i].motion_msgq, &data, K_NO_WAIT) == 0) {
+            zmk_trackpad_process(&data);
+        }
+    }
+}
+
+K_WORK_DEFINE(peripheral_motion_work, peripheral_motion_work_callback);
+
+static uint8_t split_central_motion_notify_func(struct bt_conn *conn,
+                                                struct bt_gatt_subscribe_params *params,
+                                                const void *data, uint16_t length) {
+    if (!data) {
+        LOG_DBG("[UNSUBSCRIBED]");
+        params->value_handle = 0U;
+        return BT_GATT_ITER_STOP;
+    }
+
+    if (length < sizeof(struct zmk_split_motion_data)) {
+        LOG_ERR("Motion notification too short (%u)", length);
+        return BT_GATT_ITER_CONTINUE;
+    }
+
+    int idx = peripheral_slot_index_for_conn(conn);
+    if (idx < 0) {
+        LOG_ERR("No peripheral state found for connection");
+        return BT_GATT_ITER_CONTINUE;
+    }
+
+    const struct zmk_split_motion_data *motion = data;
+    struct zmk_trackpad_data ev = {
+        .dx = sys_le16_to_cpu(motion->dx),
+        .dy = sys_le16_to_cpu(motion->dy),
+        .finger_count = motion->finger_count,
+        .gestures = sys_le16_to_cpu(motion->gestures),
+    };
+
+    if (k_msgq_put(&peripherals[idx].motion_msgq, &ev, K_NO_WAIT) != 0) {
+        LOG_WRN("Motion queue for peripheral %d full, dropping motion", idx);
+    }
+    k_work_submit(&peripheral_motion_work);
+
+    return BT_GATT_ITER_CONTINUE;
+}
+
 #if ZMK_KEYMAP_HAS_SENSORS
 K_MSGQ_DEFINE(peripheral_sensor_event_msgq, sizeof(struct zmk_sensor_event),
               CONFIG_ZMK_SPLIT_BLE_CENTRAL_POSITION_QUEUE_SIZE, 4);
@@ -183,6 +517,8 @@ K_WORK_DEFINE(peripheral_sensor_event_work, peripheral_sensor_event_work_callbac
 struct sensor_event {
     uint8_t sensor_number;
     struct sensor_value value;
+    // Not sent by older peripherals
+    uint32_t timestamp_us;
 };
 
 static uint8_t split_central_sensor_notify_func(struct bt_conn *conn,
@@ -198,10 +534,17 @@ static uint8_t split_central_sensor_notify_func(struct bt_conn *conn,
     }
     LOG_DBG("[SENSOR NOTIFICATION] data %p length %u", data, length);
 
+    int64_t timestamp = k_uptime_get();
+    struct peripheral_slot *slot = peripheral_slot_for_conn(conn);
+    if (slot != NULL && length >= sizeof(struct sensor_event)) {
+        timestamp = split_central_peripheral_timestamp(
+            slot, sys_le32_to_cpu(sensor_event->timestamp_us), timestamp);
+    }
+
     struct zmk_sensor_event ev = {
         .sensor_number = sensor_event->sensor_number,
         .value = {.val1 = (sensor_event->value).val1, .val2 = (sensor_event->value).val2},
-        .timestamp = k_uptime_get()};
+        .timestamp = timestamp};
 
     k_msgq_put(&peripheral_sensor_event_msgq, &ev, K_NO_WAIT);
     k_work_submit(&peripheral_sensor_event_work);
@@ -210,6 +553,29 @@ static uint8_t split_central_sensor_notify_func(struct bt_conn *conn,
 }
 #endif /* ZMK_KEYMAP_HAS_SENSORS */
 
+static void split_central_apply_position_state(struct peripheral_slot *slot,
+                                              const uint8_t *state) {
+    uint8_t source = slot - peripherals;
+    int64_t timestamp = MAX(k_uptime_get(), slot->last_timestamp);
+
+    for (int i = 0; i < POSITION_STATE_DATA_LEN; i++) {
+        slot->changed_positions[i] = state[i] ^ slot->position_state[i];
+        slot->position_state[i] = state[i];
+        LOG_DBG("data: %d", slot->position_state[i]);
+    }
+
+    for (int i = 0; i < POSITION_STATE_DATA_LEN; i++) {
+        for (int j = 0; j < 8; j++) {
+            if (slot->changed_positions[i] & BIT(j)) {
+                bool pressed = slot->position_state[i] & BIT(j);
+                queue_position_event(source, (i * 8) + j, pressed, timestamp);
+            }
+        }
+    }
+
+    slot->last_timestamp = timestamp;
+}
+
 static uint8_t split_central_notify_func(struct bt_conn *conn,
                                          struct bt_gatt_subscribe_params *params, const void *data,
                                          uint16_t length) {
@@ -228,27 +594,172 @@ static uint8_t split_central_notify_func(struct bt_conn *conn,
 
     LOG_DBG("[NOTIFICATION] data %p length %u", data, length);
 
-    for (int i = 0; i < POSITION_STATE_DATA_LEN; i++) {
-        slot->changed_positions[i] = ((uint8_t *)data)[i] ^ slot->position_state[i];
-        slot->position_state[i] = ((uint8_t *)data)[i];
-        LOG_DBG("data: %d", slot->position_state[i]);
+    if (length < POSITION_STATE_DATA_LEN) {
+        LOG_ERR("Position state notification too short (%u)", length);
+        return BT_GATT_ITER_CONTINUE;
     }
 
-    for (int i = 0; i < POSITION_STATE_DATA_LEN; i++) {
-        for (int j = 0; j < 8; j++) {
-            if (slot->changed_positions[i] & BIT(j)) {
-                uint32_t position = (i * 8) + j;
-                bool pressed = slot->position_state[i] & BIT(j);
-                struct zmk_position_state_changed ev = {.source =
-                                                            peripheral_slot_index_for_conn(conn),
-                                                        .position = position,
-                                                        .state = pressed,
-                                                        .timestamp = k_uptime_get()};
-
-                k_msgq_put(&peripheral_event_msgq, &ev, K_NO_WAIT);
-                k_work_submit(&peripheral_event_work);
-            }
+    link_stats[slot - peripherals].notifications++;
+    split_central_apply_position_state(slot, data);
+
+    return BT_GATT_ITER_CONTINUE;
+}
+
+static uint8_t split_central_resync_read_func(struct bt_conn *conn, uint8_t err,
+                                              struct bt_gatt_read_params *params, const void *data,
+                                              uint16_t length) {
+    struct peripheral_slot *slot = peripheral_slot_for_conn(conn);
+
+    if (slot == NULL) {
+        LOG_ERR("No peripheral state found for connection");
+        return BT_GATT_ITER_STOP;
+    }
+
+    slot->resync_pending = false;
+
+    if (err) {
+        LOG_ERR("Failed to read position state (err %d)", err);
+        return BT_GATT_ITER_STOP;
+    }
+
+    if (!data || length < POSITION_STATE_DATA_LEN) {
+        LOG_ERR("Invalid position state read (length %u)", length);
+        return BT_GATT_ITER_STOP;
+    }
+
+    LOG_DBG("Resynchronized position state");
+    split_central_apply_position_state(slot, data);
+
+    return BT_GATT_ITER_STOP;
+}
+
+// Reads the full position state bitmap to recover from lost event log records
+static void split_central_request_resync(struct bt_conn *conn, struct peripheral_slot *slot) {
+    if (slot->resync_pending || !slot->position_state_handle) {
+        return;
+    }
+
+    slot->resync_params.func = split_central_resync_read_func;
+    slot->resync_params.handle_count = 1;
+    slot->resync_params.single.handle = slot->position_state_handle;
+    slot->resync_params.single.offset = 0;
+
+    int err = bt_gatt_read(conn, &slot->resync_params);
+    if (err) {
+        LOG_ERR("Failed to request position state resync (err %d)", err);
+        return;
+    }
+
+    slot->resync_pending = true;
+    link_stats[slot - peripherals].resyncs++;
+}
+
+static void split_central_update_latency(struct zmk_split_link_stats *stats, int64_t latency_us) {
+    int32_t sample = CLAMP(latency_us, 0, INT32_MAX);
+
+    if (stats->latency_us == 0) {
+        stats->latency_us = sample;
+    } else {
+        stats->latency_us += (sample - (int32_t)stats->latency_us) / 8;
+    }
+}
+
+static uint8_t split_central_event_log_notify_func(struct bt_conn *conn,
+                                                   struct bt_gatt_subscribe_params *params,
+                                                   const void *data, uint16_t length) {
+    struct peripheral_slot *slot = peripheral_slot_for_conn(conn);
+
+    if (slot == NULL) {
+        LOG_ERR("No peripheral state found for connection");
+        return BT_GATT_ITER_CONTINUE;
+    }
+
+    if (!data) {
+        LOG_DBG("[UNSUBSCRIBED]");
+        params->value_handle = 0U;
+        return BT_GATT_ITER_STOP;
+    }
+
+    const struct zmk_split_event_log_header *header = data;
+    const struct zmk_split_event_log_record *records =
+        (const struct zmk_split_event_log_record *)((const uint8_t *)data + sizeof(*header));
+
+    if (length < sizeof(*header) || header->version != ZMK_SPLIT_EVENT_LOG_VERSION ||
+        length < sizeof(*header) + header->count * sizeof(*records)) {
+        LOG_ERR("Invalid position event log notification (length %u)", length);
+        return BT_GATT_ITER_CONTINUE;
+    }
+
+    LOG_DBG("[EVENT LOG] seq %d count %d", header->seq, header->count);
+
+    struct zmk_split_link_stats *stats = &link_stats[slot - peripherals];
+    stats->notifications++;
+
+    int start = 0;
+    if (!slot->seq_valid) {
+        // Keys may already be held when the subscription starts
+        split_central_request_resync(conn, slot);
+    } else {
+        int8_t gap = (int8_t)(header->seq - slot->expected_seq);
+        if (gap < 0) {
+            start = -gap;
+        } else if (gap > 0) {
+            LOG_WRN("Lost %d position events from peripheral, resyncing", gap);
+            stats->lost_events += gap;
+            split_central_request_resync(conn, slot);
+        }
+    }
+
+    if (start < header->count) {
+        slot->expected_seq = header->seq + header->count;
+        slot->seq_valid = true;
+    }
+
+    // Without a synchronized clock, anchor the last record to the arrival time, keeping the
+    // peripheral's spacing between records
+    uint32_t span_us = 0;
+    for (int i = 1; i < header->count; i++) {
+        span_us += sys_le16_to_cpu(records[i].delta_us);
+    }
+
+    int64_t timestamp_us = uptime_us() - span_us;
+    uint32_t peripheral_us = sys_le32_to_cpu(header->timestamp_us);
+    uint8_t source = slot - peripherals;
+
+    for (int i = 0; i < header->count; i++) {
+        if (i > 0) {
+            timestamp_us += sys_le16_to_cpu(records[i].delta_us);
+            peripheral_us += sys_le16_to_cpu(records[i].delta_us);
+        }
+
+        if (i < start) {
+            continue;
+        }
+
+        uint8_t position = records[i].position & ZMK_SPLIT_EVENT_LOG_POSITION_MASK;
+        bool pressed = records[i].position & ZMK_SPLIT_EVENT_LOG_PRESSED;
+        uint8_t *state = &slot->position_state[position / 8];
+
+        // Already applied by a resync
+        if (!!(*state & BIT(position % 8)) == pressed) {
+            continue;
         }
+
+        WRITE_BIT(*state, position % 8, pressed);
+
+        int64_t timestamp = split_central_peripheral_timestamp(slot, peripheral_us,
+                                                               timestamp_us / 1000);
+        timestamp = MAX(timestamp, slot->last_timestamp);
+        slot->last_timestamp = timestamp;
+
+        queue_position_event(source, position, pressed, timestamp);
+    }
+
+    // peripheral_us now holds the time of the last record in the notification
+    if (IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_CLOCK_SYNC) && slot->clock.valid) {
+        int64_t now_us = uptime_us();
+        split_central_update_latency(
+            stats, now_us - split_clock_to_central_us(&slot->clock, peripheral_us, now_us));
     }
 
     return BT_GATT_ITER_CONTINUE;
@@ -269,44 +780,327 @@ static void split_central_subscribe(struct bt_conn *conn, struct bt_gatt_subscri
     }
 }
 
-#if ZMK_KEYMAP_HAS_SENSORS
-static struct bt_uuid_128 sensor_uuid = BT_UUID_INIT_128(ZMK_SPLIT_BT_SERVICE_UUID);
-static struct bt_gatt_discover_params sensor_discover_params;
-static struct bt_gatt_subscribe_params sensor_subscribe_params;
-static uint8_t split_central_sensor_desc_discovery_func(struct bt_conn *conn,
-                                                        const struct bt_gatt_attr *attr,
-                                                        struct bt_gatt_discover_params *params) {
-    int err;
+static uint8_t split_central_batch_status_read_func(struct bt_conn *conn, uint8_t err,
+                                                    struct bt_gatt_read_params *params,
+                                                    const void *data, uint16_t length) {
+    struct peripheral_slot *slot = peripheral_slot_for_conn(conn);
+    if (slot == NULL) {
+        return BT_GATT_ITER_STOP;
+    }
 
-    if (!bt_uuid_cmp(sensor_discover_params.uuid,
-                     BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_SENSOR_STATE_UUID))) {
-        memcpy(&sensor_uuid, BT_UUID_GATT_CCC, sizeof(sensor_uuid));
-        sensor_discover_params.uuid = &sensor_uuid.uuid;
-        sensor_discover_params.start_handle = attr->handle;
-        sensor_discover_params.type = BT_GATT_DISCOVER_DESCRIPTOR;
+    if (err || data == NULL || length < 1) {
+        LOG_WRN("Failed to read the behavior batch status (err %d), not batching", err);
+        return BT_GATT_ITER_STOP;
+    }
 
-        sensor_subscribe_params.value_handle = bt_gatt_attr_value_handle(attr);
+    if (((const uint8_t *)data)[0] & ZMK_SPLIT_RUN_BEHAVIOR_BATCH_STATUS_IDS_COLLIDE) {
+        LOG_WRN("Peripheral behavior IDs collide, invoking behaviors by label");
+        return BT_GATT_ITER_STOP;
+    }
+
+    slot->run_behavior_batch_ok = true;
+    return BT_GATT_ITER_STOP;
+}
+
+// Behaviors are invoked by label until the peripheral confirms it can resolve every ID
+static void split_central_read_batch_status(struct peripheral_slot *slot) {
+    slot->run_behavior_batch_ok = false;
+    if (!slot->run_behavior_batch_handle) {
+        return;
+    }
 
-        err = bt_gatt_discover(conn, &sensor_discover_params);
+    slot->batch_status_params.func = split_central_batch_status_read_func;
+    slot->batch_status_params.handle_count = 1;
+    slot->batch_status_params.single.handle = slot->run_behavior_batch_handle;
+    slot->batch_status_params.single.offset = 0;
+
+    int err = bt_gatt_read(slot->conn, &slot->batch_status_params);
+    if (err) {
+        LOG_ERR("Failed to read the behavior batch status (err %d)", err);
+    }
+}
+
+static int split_central_start_discovery(struct peripheral_slot *slot);
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_HANDLE_CACHE)
+
+#define SPLIT_DB_HASH_LEN 16
+
+// Handles of the split service characteristics, saved per peripheral address
+struct split_handle_cache {
+    bt_addr_le_t addr;
+    uint8_t db_hash[SPLIT_DB_HASH_LEN];
+    uint16_t position_state;
+    uint16_t position_events;
+    uint16_t motion;
+    uint16_t sensor_state;
+    uint16_t time_sync;
+    uint16_t run_behavior;
+    uint16_t run_behavior_batch;
+} __packed;
+
+static struct split_handle_cache handle_cache[ZMK_BLE_SPLIT_PERIPHERAL_COUNT];
+
+static struct split_handle_cache *split_handle_cache_for_addr(const bt_addr_le_t *addr) {
+    for (int i = 0; i < ZMK_BLE_SPLIT_PERIPHERAL_COUNT; i++) {
+        if (!bt_addr_le_cmp(&handle_cache[i].addr, addr)) {
+            return &handle_cache[i];
+        }
+    }
+    return NULL;
+}
+
+static void split_central_save_handles_work_callback(struct k_work *work) {
+    char setting_name[20];
+
+    for (int i = 0; i < ZMK_BLE_SPLIT_PERIPHERAL_COUNT; i++) {
+        sprintf(setting_name, "split/handles/%d", i);
+        int err = settings_save_one(setting_name, &handle_cache[i], sizeof(handle_cache[i]));
         if (err) {
-            LOG_ERR("Discover failed (err %d)", err);
+            LOG_ERR("Failed to save split handles %d (err %d)", i, err);
         }
+    }
+}
+
+K_WORK_DEFINE(split_central_save_handles_work, split_central_save_handles_work_callback);
+
+static int split_handle_cache_handle_set(const char *name, size_t len, settings_read_cb read_cb,
+                                         void *cb_arg) {
+    char *endptr;
+    uint8_t idx = strtoul(name, &endptr, 10);
+    if (*endptr != '\0') {
+        LOG_WRN("Invalid split handles index: %s", log_strdup(name));
+        return -EINVAL;
+    }
+
+    if (len != sizeof(struct split_handle_cache)) {
+        LOG_ERR("Invalid split handles size (got %d expected %d)", len,
+                sizeof(struct split_handle_cache));
+        return -EINVAL;
+    }
+
+    if (idx >= ZMK_BLE_SPLIT_PERIPHERAL_COUNT) {
+        LOG_WRN("Split handles index %d is larger than max of %d", idx,
+                ZMK_BLE_SPLIT_PERIPHERAL_COUNT);
+        return -EINVAL;
+    }
+
+    int err = read_cb(cb_arg, &handle_cache[idx], sizeof(struct split_handle_cache));
+    if (err <= 0) {
+        LOG_ERR("Failed to handle split handles from settings (err %d)", err);
+        return err;
+    }
+
+    return 0;
+}
+
+struct settings_handler split_handles_handler = {.name = "split/handles",
+                                                 .h_set = split_handle_cache_handle_set};
+
+// Every notifying characteristic in the split service is directly followed by its CCC descriptor.
+// The database hash check catches peripherals with a different layout.
+static void split_central_subscribe_cached(struct bt_conn *conn,
+                                           struct bt_gatt_subscribe_params *params,
+                                           uint16_t value_handle, bt_gatt_notify_func_t notify) {
+    if (!value_handle) {
+        return;
+    }
+
+    params->disc_params = NULL;
+    params->end_handle = 0xffff;
+    params->value_handle = value_handle;
+    params->ccc_handle = value_handle + 1;
+    params->notify = notify;
+    params->value = BT_GATT_CCC_NOTIFY;
+    split_central_subscribe(conn, params);
+}
+
+static bool split_central_use_cached_handles(struct peripheral_slot *slot) {
+    const struct split_handle_cache *cache =
+        split_handle_cache_for_addr(bt_conn_get_dst(slot->conn));
+    if (cache == NULL || !cache->position_state) {
+        return false;
+    }
+
+    LOG_DBG("Using cached split handles");
+    slot->handles_cached = true;
+    slot->position_state_handle = cache->position_state;
+    slot->run_behavior_handle = cache->run_behavior;
+    slot->run_behavior_batch_handle = cache->run_behavior_batch;
+    slot->time_sync_handle = cache->time_sync;
+    split_central_read_batch_status(slot);
+
+    if (cache->position_events) {
+        split_central_subscribe_cached(slot->conn, &slot->event_log_subscribe_params,
+                                       cache->position_events,
+                                       split_central_event_log_notify_func);
     } else {
-        sensor_subscribe_params.notify = split_central_sensor_notify_func;
-        sensor_subscribe_params.value = BT_GATT_CCC_NOTIFY;
-        sensor_subscribe_params.ccc_handle = attr->handle;
-        split_central_subscribe(conn, &sensor_subscribe_params);
+        split_central_subscribe_cached(slot->conn, &slot->subscribe_params, cache->position_state,
+                                       split_central_notify_func);
     }
+    split_central_subscribe_cached(slot->conn, &slot->motion_subscribe_params, cache->motion,
+                                   split_central_motion_notify_func);
+#if ZMK_KEYMAP_HAS_SENSORS
+    split_central_subscribe_cached(slot->conn, &slot->sensor_subscribe_params,
+                                   cache->sensor_state, split_central_sensor_notify_func);
+#endif /* ZMK_KEYMAP_HAS_SENSORS */
 
-    return BT_GATT_ITER_STOP;
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_CLOCK_SYNC)
+    if (slot->time_sync_handle) {
+        k_work_reschedule(&split_central_clock_sync_work, K_NO_WAIT);
+    }
+#endif
+
+    return true;
 }
+
+static void split_central_store_handles(struct peripheral_slot *slot, const uint8_t *db_hash) {
+    const bt_addr_le_t *addr = bt_conn_get_dst(slot->conn);
+    struct split_handle_cache *cache = split_handle_cache_for_addr(addr);
+    if (cache == NULL) {
+        cache = split_handle_cache_for_addr(BT_ADDR_LE_ANY);
+    }
+    if (cache == NULL) {
+        cache = &handle_cache[slot - peripherals];
+    }
+
+    *cache = (struct split_handle_cache){
+        .position_state = slot->position_state_handle,
+        .position_events = slot->event_log_subscribe_params.value_handle,
+        .motion = slot->motion_subscribe_params.value_handle,
+#if ZMK_KEYMAP_HAS_SENSORS
+        .sensor_state = slot->sensor_subscribe_params.value_handle,
 #endif /* ZMK_KEYMAP_HAS_SENSORS */
+        .time_sync = slot->time_sync_handle,
+        .run_behavior = slot->run_behavior_handle,
+        .run_behavior_batch = slot->run_behavior_batch_handle,
+    };
+    bt_addr_le_copy(&cache->addr, addr);
+    memcpy(cache->db_hash, db_hash, SPLIT_DB_HASH_LEN);
+
+    k_work_submit(&split_central_save_handles_work);
+}
+
+static void split_central_rediscover(struct bt_conn *conn, struct peripheral_slot *slot) {
+    struct bt_gatt_subscribe_params *subscriptions[] = {
+        &slot->subscribe_params,
+        &slot->event_log_subscribe_params,
+        &slot->motion_subscribe_params,
+#if ZMK_KEYMAP_HAS_SENSORS
+        &slot->sensor_subscribe_params,
+#endif /* ZMK_KEYMAP_HAS_SENSORS */
+    };
+
+    for (int i = 0; i < ARRAY_SIZE(subscriptions); i++) {
+        if (subscriptions[i]->value_handle) {
+            bt_gatt_unsubscribe(conn, subscriptions[i]);
+        }
+        subscriptions[i]->value_handle = 0;
+        subscriptions[i]->ccc_handle = 0;
+    }
+
+    slot->handles_cached = false;
+    slot->position_state_handle = 0;
+    slot->run_behavior_handle = 0;
+    slot->run_behavior_batch_handle = 0;
+    slot->run_behavior_batch_ok = false;
+    slot->time_sync_handle = 0;
+    slot->seq_valid = false;
+
+    int err = split_central_start_discovery(slot);
+    if (err) {
+        LOG_ERR("Discover failed(err %d)", err);
+    }
+}
+
+static uint8_t split_central_db_hash_read_func(struct bt_conn *conn, uint8_t err,
+                                               struct bt_gatt_read_params *params,
+                                               const void *data, uint16_t length) {
+    struct peripheral_slot *slot = peripheral_slot_for_conn(conn);
+    if (slot == NULL || !slot->db_hash_pending) {
+        return BT_GATT_ITER_STOP;
+    }
+
+    slot->db_hash_pending = false;
+
+    if (err || !data || length != SPLIT_DB_HASH_LEN) {
+        // Without a hash there's no way to tell a stale cache apart, so never use one
+        LOG_WRN("Peripheral database hash unavailable (err %d)", err);
+        if (slot->handles_cached) {
+            split_central_rediscover(conn, slot);
+        }
+        return BT_GATT_ITER_STOP;
+    }
+
+    if (!slot->handles_cached) {
+        split_central_store_handles(slot, data);
+        return BT_GATT_ITER_STOP;
+    }
+
+    struct split_handle_cache *cache = split_handle_cache_for_addr(bt_conn_get_dst(conn));
+    if (cache != NULL && !memcmp(cache->db_hash, data, SPLIT_DB_HASH_LEN)) {
+        LOG_DBG("Cached split handles are current");
+        slot->handles_cached = false;
+        return BT_GATT_ITER_STOP;
+    }
+
+    LOG_INF("Peripheral database changed, discovering split service again");
+    if (cache != NULL) {
+        *cache = (struct split_handle_cache){0};
+        k_work_submit(&split_central_save_handles_work);
+    }
+    split_central_rediscover(conn, slot);
+
+    return BT_GATT_ITER_STOP;
+}
+
+static void split_central_read_db_hash(struct bt_conn *conn, struct peripheral_slot *slot) {
+    slot->db_hash_params.func = split_central_db_hash_read_func;
+    slot->db_hash_params.handle_count = 0;
+    slot->db_hash_params.by_uuid.uuid = BT_UUID_GATT_DB_HASH;
+    slot->db_hash_params.by_uuid.start_handle = 0x0001;
+    slot->db_hash_params.by_uuid.end_handle = 0xffff;
+    slot->db_hash_pending = true;
+
+    int err = bt_gatt_read(conn, &slot->db_hash_params);
+    if (err) {
+        LOG_ERR("Failed to read peripheral database hash (err %d)", err);
+        slot->db_hash_pending = false;
+        if (slot->handles_cached) {
+            split_central_rediscover(conn, slot);
+        }
+    }
+}
+
+#endif /* IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_HANDLE_CACHE) */
+
+static void split_central_discovery_complete(struct bt_conn *conn, struct peripheral_slot *slot) {
+    if (slot->position_state_handle && !slot->event_log_subscribe_params.value_handle) {
+        LOG_DBG("No position event log found, using position state notifications");
+        split_central_subscribe(conn, &slot->subscribe_params);
+    }
+
+    split_central_read_batch_status(slot);
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_HANDLE_CACHE)
+    if (slot->position_state_handle) {
+        split_central_read_db_hash(conn, slot);
+    }
+#endif
+}
 
 static uint8_t split_central_chrc_discovery_func(struct bt_conn *conn,
                                                  const struct bt_gatt_attr *attr,
                                                  struct bt_gatt_discover_params *params) {
+    struct peripheral_slot *slot = peripheral_slot_for_conn(conn);
+    if (slot == NULL) {
+        LOG_ERR("No peripheral state found for connection");
+        return BT_GATT_ITER_STOP;
+    }
+
     if (!attr) {
         LOG_DBG("Discover complete");
+        split_central_discovery_complete(conn, slot);
         return BT_GATT_ITER_STOP;
     }
 
@@ -315,12 +1109,6 @@ static uint8_t split_central_chrc_discovery_func(struct bt_conn *conn,
         return BT_GATT_ITER_STOP;
     }
 
-    struct peripheral_slot *slot = peripheral_slot_for_conn(conn);
-    if (slot == NULL) {
-        LOG_ERR("No peripheral state found for connection");
-        return BT_GATT_ITER_STOP;
-    }
-
     LOG_DBG("[ATTRIBUTE] handle %u", attr->handle);
 
     if (!bt_uuid_cmp(((struct bt_gatt_chrc *)attr->user_data)->uuid,
@@ -330,21 +1118,72 @@ static uint8_t split_central_chrc_discovery_func(struct bt_conn *conn,
         slot->discover_params.start_handle = attr->handle + 2;
         slot->discover_params.type = BT_GATT_DISCOVER_CHARACTERISTIC;
 
+        // Only subscribed to if the peripheral predates the position event log
+        slot->position_state_handle = bt_gatt_attr_value_handle(attr);
         slot->subscribe_params.disc_params = &slot->sub_discover_params;
         slot->subscribe_params.end_handle = slot->discover_params.end_handle;
-        slot->subscribe_params.value_handle = bt_gatt_attr_value_handle(attr);
+        slot->subscribe_params.value_handle = slot->position_state_handle;
         slot->subscribe_params.notify = split_central_notify_func;
         slot->subscribe_params.value = BT_GATT_CCC_NOTIFY;
-        split_central_subscribe(conn, &slot->subscribe_params);
     } else if (!bt_uuid_cmp(((struct bt_gatt_chrc *)attr->user_data)->uuid,
-                            BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_RUN_BEHAVIOR_UUID))) {
+                            BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_POSITION_EVENTS_UUID))) {
+        LOG_DBG("Found position event log characteristic");
+        slot->event_log_subscribe_params.disc_params = &slot->event_log_sub_discover_params;
+        slot->event_log_subscribe_params.end_handle = 0xffff;
+        slot->event_log_subscribe_params.value_handle = bt_gatt_attr_value_handle(attr);
+        slot->event_log_subscribe_params.notify = split_central_event_log_notify_func;
+        slot->event_log_subscribe_params.value = BT_GATT_CCC_NOTIFY;
+        split_central_subscribe(conn, &slot->event_log_subscribe_params);
+    } else if (!bt_uuid_cmp(((struct bt_gatt_chrc *)attr->user_data)->uuid,
+                            BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_MOTION_UUID))) {
+        LOG_DBG("Found motion characteristic");
+        slot->motion_subscribe_params.disc_params = &slot->motion_sub_discover_params;
+        slot->motion_subscribe_params.end_handle = 0xffff;
+        slot->motion_subscribe_params.value_handle = bt_gatt_attr_value_handle(attr);
+        slot->motion_subscribe_params.notify = split_central_motion_notify_func;
+        slot->motion_subscribe_params.value = BT_GATT_CCC_NOTIFY;
+        split_central_subscribe(conn, &slot->motion_subscribe_params);
+    } else if (!bt_uuid_cmp(((struct bt_gatt_chrc *)attr->user_data)->uuid,
+                            BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_TIME_SYNC_UUID))) {
+        LOG_DBG("Found time sync characteristic");
+        slot->time_sync_handle = bt_gatt_attr_value_handle(attr);
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_CLOCK_SYNC)
+        k_work_reschedule(&split_central_clock_sync_work, K_NO_WAIT);
+#endif
+    } else if (!bt_uuid_cmp(((struct bt_gatt_chrc *)attr->user_data)->uuid,
+                            BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_RUN_BEHAVIOR_UUID)) &&
+               !(((struct bt_gatt_chrc *)attr->user_data)->properties & BT_GATT_CHRC_NOTIFY)) {
         LOG_DBG("Found run behavior handle");
         slot->run_behavior_handle = bt_gatt_attr_value_handle(attr);
+    } else if (!bt_uuid_cmp(((struct bt_gatt_chrc *)attr->user_data)->uuid,
+                            BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_SENSOR_STATE_UUID))) {
+        // Shares its UUID with the run behavior characteristic, but is the one that notifies
+#if ZMK_KEYMAP_HAS_SENSORS
+        LOG_DBG("Found sensor state characteristic");
+        slot->sensor_subscribe_params.disc_params = &slot->sensor_sub_discover_params;
+        slot->sensor_subscribe_params.end_handle = 0xffff;
+        slot->sensor_subscribe_params.value_handle = bt_gatt_attr_value_handle(attr);
+        slot->sensor_subscribe_params.notify = split_central_sensor_notify_func;
+        slot->sensor_subscribe_params.value = BT_GATT_CCC_NOTIFY;
+        split_central_subscribe(conn, &slot->sensor_subscribe_params);
+#endif /* ZMK_KEYMAP_HAS_SENSORS */
+    } else if (!bt_uuid_cmp(((struct bt_gatt_chrc *)attr->user_data)->uuid,
+                            BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_RUN_BEHAVIOR_BATCH_UUID))) {
+        LOG_DBG("Found run behavior batch handle");
+        slot->run_behavior_batch_handle = bt_gatt_attr_value_handle(attr);
     }
 
-    bool subscribed = (slot->run_behavior_handle && slot->subscribe_params.value_handle);
+    bool subscribed = (slot->run_behavior_handle && slot->run_behavior_batch_handle &&
+                       slot->position_state_handle &&
+                       slot->event_log_subscribe_params.value_handle && slot->time_sync_handle &&
+                       slot->motion_subscribe_params.value_handle);
+
+    if (subscribed) {
+        split_central_discovery_complete(conn, slot);
+        return BT_GATT_ITER_STOP;
+    }
 
-    return subscribed ? BT_GATT_ITER_STOP : BT_GATT_ITER_CONTINUE;
+    return BT_GATT_ITER_CONTINUE;
 }
 
 static uint8_t split_central_service_discovery_func(struct bt_conn *conn,
@@ -380,24 +1219,19 @@ static uint8_t split_central_service_discovery_func(struct bt_conn *conn,
         LOG_ERR("Failed to start discovering split service characteristics (err %d)", err);
     }
 
-#if ZMK_KEYMAP_HAS_SENSORS
-        memcpy(&sensor_uuid, BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_SENSOR_STATE_UUID),
-               sizeof(sensor_uuid));
-        sensor_discover_params.uuid = &sensor_uuid.uuid;
-        sensor_discover_params.start_handle = attr->handle;
-        sensor_discover_params.end_handle = 0xffff;
-        sensor_discover_params.type = BT_GATT_DISCOVER_CHARACTERISTIC;
-        sensor_discover_params.func = split_central_sensor_desc_discovery_func;
-
-        err = bt_gatt_discover(conn, &sensor_discover_params);
-        if (err) {
-            LOG_ERR("Discover failed (err %d)", err);
-        }
-#endif /* ZMK_KEYMAP_HAS_SENSORS */
-
     return BT_GATT_ITER_STOP;
 }
 
+static int split_central_start_discovery(struct peripheral_slot *slot) {
+    slot->discover_params.uuid = &split_service_uuid.uuid;
+    slot->discover_params.func = split_central_service_discovery_func;
+    slot->discover_params.start_handle = 0x0001;
+    slot->discover_params.end_handle = 0xffff;
+    slot->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
+
+    return bt_gatt_discover(slot->conn, &slot->discover_params);
+}
+
 static void split_central_process_connection(struct bt_conn *conn) {
     int err;
 
@@ -415,14 +1249,27 @@ static void split_central_process_connection(struct bt_conn *conn) {
         return;
     }
 
-    if (!slot->subscribe_params.value_handle) {
-        slot->discover_params.uuid = &split_service_uuid.uuid;
-        slot->discover_params.func = split_central_service_discovery_func;
-        slot->discover_params.start_handle = 0x0001;
-        slot->discover_params.end_handle = 0xffff;
-        slot->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
+    err = bt_conn_le_phy_update(conn, BT_CONN_LE_PHY_PARAM_2M);
+    if (err) {
+        LOG_ERR("Update phy conn failed (err %d)", err);
+    }
+
+#if IS_ENABLED(CONFIG_BT_USER_DATA_LEN_UPDATE)
+    err = bt_conn_le_data_len_update(conn, BT_LE_DATA_LEN_PARAM_MAX);
+    if (err) {
+        LOG_ERR("Update data length failed (err %d)", err);
+    }
+#endif
 
-        err = bt_gatt_discover(slot->conn, &slot->discover_params);
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_HANDLE_CACHE)
+    if (!slot->position_state_handle && split_central_use_cached_handles(slot)) {
+        // Subscriptions are already live, the hash read confirms they point at the right handles
+        split_central_read_db_hash(conn, slot);
+    }
+#endif
+
+    if (!slot->position_state_handle) {
+        err = split_central_start_discovery(slot);
         if (err) {
             LOG_ERR("Discover failed(err %d)", err);
             return;
@@ -483,7 +1330,7 @@ static bool split_central_eir_found(struct bt_data *data, void *user_data) {
                 continue;
             }
 
-            uint8_t slot_idx = reserve_peripheral_slot();
+            int slot_idx = reserve_peripheral_slot();
             if (slot_idx < 0) {
                 LOG_ERR("Faild to reserve peripheral slot (err %d)", slot_idx);
                 continue;
@@ -495,12 +1342,8 @@ static bool split_central_eir_found(struct bt_data *data, void *user_data) {
             if (slot->conn) {
                 LOG_DBG("Found existing connection");
                 split_central_process_connection(slot->conn);
-                err = bt_conn_le_phy_update(slot->conn, BT_CONN_LE_PHY_PARAM_2M);
-                if (err) {
-                    LOG_ERR("Update phy conn failed (err %d)", err);
-                }
             } else {
-                param = BT_LE_CONN_PARAM(0x0006, 0x0006, 30, 400);
+                param = SPLIT_ACTIVE_CONN_PARAM;
 
                 LOG_DBG("Initiating new connnection");
 
@@ -574,6 +1417,14 @@ static void split_central_connected(struct bt_conn *conn, uint8_t conn_err) {
 
     confirm_peripheral_slot_conn(conn);
     split_central_process_connection(conn);
+
+    ZMK_EVENT_RAISE(new_zmk_split_peripheral_status_changed(
+        (struct zmk_split_peripheral_status_changed){.connected = true}));
+
+    // Keep looking for the remaining peripherals
+    if (peripheral_slot_index_for_conn(NULL) >= 0) {
+        start_scan();
+    }
 }
 
 static void split_central_disconnected(struct bt_conn *conn, uint8_t reason) {
@@ -587,16 +1438,136 @@ static void split_central_disconnected(struct bt_conn *conn, uint8_t reason) {
     err = release_peripheral_slot_for_conn(conn);
 
     is_connected = false;
+    for (int i = 0; i < ZMK_BLE_SPLIT_PERIPHERAL_COUNT; i++) {
+        is_connected |= (peripherals[i].state == PERIPHERAL_SLOT_STATE_CONNECTED);
+    }
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_CLOCK_SYNC)
+    if (!is_connected) {
+        k_work_cancel_delayable(&split_central_clock_sync_work);
+    }
+#endif
 
     if (err < 0) {
         return;
     }
 
+    ZMK_EVENT_RAISE(new_zmk_split_peripheral_status_changed(
+        (struct zmk_split_peripheral_status_changed){.connected = false}));
+
     start_scan();
 }
 
 bool zmk_split_bt_central_is_connected() { return is_connected; }
 
+bool zmk_split_central_is_connected(void) { return is_connected; }
+
+int zmk_split_bt_central_get_link_stats(uint8_t index, struct zmk_split_link_stats *stats) {
+    if (index >= ZMK_BLE_SPLIT_PERIPHERAL_COUNT) {
+        return -EINVAL;
+    }
+
+    *stats = link_stats[index];
+    return 0;
+}
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_RSSI)
+static int split_central_read_rssi(struct bt_conn *conn, int8_t *rssi) {
+    struct bt_hci_cp_read_rssi *cp;
+    struct bt_hci_rp_read_rssi *rp;
+    struct net_buf *buf, *rsp = NULL;
+    uint16_t handle;
+
+    int err = bt_hci_get_conn_handle(conn, &handle);
+    if (err) {
+        return err;
+    }
+
+    buf = bt_hci_cmd_create(BT_HCI_OP_READ_RSSI, sizeof(*cp));
+    if (!buf) {
+        return -ENOBUFS;
+    }
+
+    cp = net_buf_add(buf, sizeof(*cp));
+    cp->handle = sys_cpu_to_le16(handle);
+
+    err = bt_hci_cmd_send_sync(BT_HCI_OP_READ_RSSI, buf, &rsp);
+    if (err) {
+        return err;
+    }
+
+    rp = (void *)rsp->data;
+    err = rp->status ? -EIO : 0;
+    *rssi = rp->rssi;
+    net_buf_unref(rsp);
+
+    return err;
+}
+
+static void split_central_rssi_work_callback(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(split_central_rssi_work, split_central_rssi_work_callback);
+
+static void split_central_rssi_work_callback(struct k_work *work) {
+    for (int i = 0; i < ZMK_BLE_SPLIT_PERIPHERAL_COUNT; i++) {
+        int8_t rssi;
+
+        if (peripherals[i].state != PERIPHERAL_SLOT_STATE_CONNECTED) {
+            continue;
+        }
+
+        int err = split_central_read_rssi(peripherals[i].conn, &rssi);
+        if (err) {
+            LOG_WRN("Failed to read peripheral RSSI (err %d)", err);
+            continue;
+        }
+
+        link_stats[i].rssi = rssi;
+    }
+
+    k_work_schedule(&split_central_rssi_work, K_MSEC(CONFIG_ZMK_SPLIT_BLE_CENTRAL_RSSI_INTERVAL));
+}
+#endif /* IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_RSSI) */
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_DYNAMIC_CONN_PARAMS)
+static void split_central_update_conn_param(struct peripheral_slot *slot, bool active) {
+    const struct bt_le_conn_param *param = active ? SPLIT_ACTIVE_CONN_PARAM : SPLIT_IDLE_CONN_PARAM;
+    struct bt_conn_info info;
+
+    if (bt_conn_get_info(slot->conn, &info) == 0 && info.le.interval == param->interval_min &&
+        info.le.latency == param->latency) {
+        return;
+    }
+
+    LOG_DBG("Switching peripheral connection to %s parameters", active ? "active" : "idle");
+
+    int err = bt_conn_le_param_update(slot->conn, param);
+    if (err) {
+        LOG_ERR("Failed to update peripheral connection parameters (err %d)", err);
+    }
+}
+
+// Peripheral key and sensor events raise activity on the central too, so the central alone decides
+// when the split links slow down and speed back up.
+static int split_central_activity_listener(const zmk_event_t *eh) {
+    struct zmk_activity_state_changed *ev = as_zmk_activity_state_changed(eh);
+    if (ev == NULL || ev->state == ZMK_ACTIVITY_SLEEP) {
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+    for (int i = 0; i < ZMK_BLE_SPLIT_PERIPHERAL_COUNT; i++) {
+        if (peripherals[i].state == PERIPHERAL_SLOT_STATE_CONNECTED) {
+            split_central_update_conn_param(&peripherals[i], ev->state == ZMK_ACTIVITY_ACTIVE);
+        }
+    }
+
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(split_central_activity, split_central_activity_listener);
+ZMK_SUBSCRIPTION(split_central_activity, zmk_activity_state_changed);
+#endif /* IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_DYNAMIC_CONN_PARAMS) */
+
 static struct bt_conn_cb conn_callbacks = {
     .connected = split_central_connected,
     .disconnected = split_central_disconnected,
@@ -609,6 +1580,7 @@ struct k_work_q split_central_split_run_q;
 
 struct zmk_split_run_behavior_payload_wrapper {
     uint8_t source;
+    uint32_t behavior_id;
     struct zmk_split_run_behavior_payload payload;
 };
 
@@ -616,25 +1588,92 @@ K_MSGQ_DEFINE(zmk_split_central_split_run_msgq,
               sizeof(struct zmk_split_run_behavior_payload_wrapper),
               CONFIG_ZMK_BLE_SPLIT_CENTRAL_SPLIT_RUN_QUEUE_SIZE, 4);
 
+#define RUN_BEHAVIOR_BATCH_MAX_LEN 64
+
+static size_t encode_run_behavior_record(uint8_t *buf,
+                                         const struct zmk_split_run_behavior_payload_wrapper *w) {
+    struct zmk_split_run_behavior_record *record = (struct zmk_split_run_behavior_record *)buf;
+    size_t len = sizeof(*record);
+
+    record->behavior_id = sys_cpu_to_le32(w->behavior_id);
+    record->position = w->payload.data.position;
+    record->flags = w->payload.data.state ? ZMK_SPLIT_RUN_BEHAVIOR_PRESSED : 0;
+
+    if (w->payload.data.param1) {
+        record->flags |= ZMK_SPLIT_RUN_BEHAVIOR_HAS_PARAM1;
+        sys_put_le32(w->payload.data.param1, &buf[len]);
+        len += sizeof(uint32_t);
+    }
+
+    if (w->payload.data.param2) {
+        record->flags |= ZMK_SPLIT_RUN_BEHAVIOR_HAS_PARAM2;
+        sys_put_le32(w->payload.data.param2, &buf[len]);
+        len += sizeof(uint32_t);
+    }
+
+    return len;
+}
+
+static void write_run_behavior_batch(uint8_t source, const uint8_t *batch, size_t len) {
+    int err = bt_gatt_write_without_response(
+        peripherals[source].conn, peripherals[source].run_behavior_batch_handle, batch, len, true);
+
+    if (err) {
+        LOG_ERR("Failed to write the behavior batch characteristic (err %d)", err);
+    }
+}
+
 void split_central_split_run_callback(struct k_work *work) {
     struct zmk_split_run_behavior_payload_wrapper payload_wrapper;
+    uint8_t batch[RUN_BEHAVIOR_BATCH_MAX_LEN];
+    size_t batch_len = 0;
+    uint8_t batch_source = 0;
 
     LOG_DBG("");
 
     while (k_msgq_get(&zmk_split_central_split_run_msgq, &payload_wrapper, K_NO_WAIT) == 0) {
-        if (peripherals[payload_wrapper.source].state != PERIPHERAL_SLOT_STATE_CONNECTED) {
+        struct peripheral_slot *slot = &peripherals[payload_wrapper.source];
+
+        if (slot->state != PERIPHERAL_SLOT_STATE_CONNECTED) {
             LOG_ERR("Source not connected");
             continue;
         }
 
-        int err = bt_gatt_write_without_response(
-            peripherals[payload_wrapper.source].conn,
-            peripherals[payload_wrapper.source].run_behavior_handle, &payload_wrapper.payload,
-            sizeof(struct zmk_split_run_behavior_payload), true);
+        if (!slot->run_behavior_batch_ok) {
+            // Peripheral predates batched invocations, or can't resolve every behavior ID
+            int err = bt_gatt_write_without_response(slot->conn, slot->run_behavior_handle,
+                                                     &payload_wrapper.payload,
+                                                     sizeof(struct zmk_split_run_behavior_payload),
+                                                     true);
 
-        if (err) {
-            LOG_ERR("Failed to write the behavior characteristic (err %d)", err);
+            if (err) {
+                LOG_ERR("Failed to write the behavior characteristic (err %d)", err);
+            }
+            continue;
+        }
+
+        uint8_t record[ZMK_SPLIT_RUN_BEHAVIOR_RECORD_MAX_LEN];
+        size_t record_len = encode_run_behavior_record(record, &payload_wrapper);
+        size_t max_len = MIN(sizeof(batch), bt_gatt_get_mtu(slot->conn) - 3);
+
+        if (batch_len > 0 &&
+            (batch_source != payload_wrapper.source || batch_len + record_len > max_len)) {
+            write_run_behavior_batch(batch_source, batch, batch_len);
+            batch_len = 0;
+        }
+
+        if (batch_len == 0) {
+            batch[0] = ZMK_SPLIT_RUN_BEHAVIOR_BATCH_VERSION;
+            batch_len = 1;
+            batch_source = payload_wrapper.source;
         }
+
+        memcpy(&batch[batch_len], record, record_len);
+        batch_len += record_len;
+    }
+
+    if (batch_len > 0) {
+        write_run_behavior_batch(batch_source, batch, batch_len);
     }
 }
 
@@ -679,11 +1718,51 @@ int zmk_split_bt_invoke_behavior(uint8_t source, struct zmk_behavior_binding *bi
                 log_strdup(binding->behavior_dev), log_strdup(payload.behavior_dev));
     }
 
-    struct zmk_split_run_behavior_payload_wrapper wrapper = {.source = source, .payload = payload};
+    struct zmk_split_run_behavior_payload_wrapper wrapper = {
+        .source = source,
+        .behavior_id = zmk_split_behavior_id(binding->behavior_dev),
+        .payload = payload,
+    };
     return split_bt_invoke_behavior_payload(wrapper);
 }
 
+int zmk_split_central_invoke_behavior(uint8_t source, struct zmk_behavior_binding *binding,
+                                      struct zmk_behavior_binding_event event, bool state) {
+    return zmk_split_bt_invoke_behavior(source, binding, event, state);
+}
+
 int zmk_split_bt_central_init(const struct device *_arg) {
+    for (int i = 0; i < ZMK_BLE_SPLIT_PERIPHERAL_COUNT; i++) {
+        k_msgq_init(&peripherals[i].event_msgq, peripherals[i].event_msgq_buffer,
+                    sizeof(struct zmk_position_state_changed),
+                    CONFIG_ZMK_SPLIT_BLE_CENTRAL_POSITION_QUEUE_SIZE);
+        k_msgq_init(&peripherals[i].motion_msgq, peripherals[i].motion_msgq_buffer,
+                    sizeof(struct zmk_trackpad_data),
+                    CONFIG_ZMK_SPLIT_BLE_CENTRAL_POSITION_QUEUE_SIZE);
+    }
+
+#if IS_ENABLED(CONFIG_ZMK_CONFIG)
+    if (zmk_config_bind(ZMK_CONFIG_KEY_SPLIT_LINK_STATS, link_stats, sizeof(link_stats), false,
+                        NULL, NULL) == NULL) {
+        LOG_ERR("Failed to bind split link stats");
+    }
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_HANDLE_CACHE)
+    settings_subsys_init();
+
+    int err = settings_register(&split_handles_handler);
+    if (err) {
+        LOG_ERR("Failed to setup the split handles settings handler (err %d)", err);
+    } else {
+        settings_load_subtree("split/handles");
+    }
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_CENTRAL_RSSI)
+    k_work_schedule(&split_central_rssi_work, K_MSEC(CONFIG_ZMK_SPLIT_BLE_CENTRAL_RSSI_INTERVAL));
+#endif
+
     k_work_queue_start(&split_central_split_run_q, split_central_split_run_q_stack,
                        K_THREAD_STACK_SIZEOF(split_central_split_run_q_stack),
                        CONFIG_ZMK_BLE_THREAD_PRIORITY, NULL);
@@ -34,6 +34,8 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 #include <zmk/events/split_peripheral_status_changed.h>
 #include <zmk/ble.h>
 #include <zmk/split/bluetooth/uuid.h>
+#include <zmk/split/bluetooth/service.h>
+#include <zmk/split/peripheral.h>
 
 static const struct bt_data zmk_ble_ad[] = {
     BT_DATA_BYTES(BT_DATA_FLAGS, (BT_LE_AD_GENERAL | BT_LE_AD_NO_BREDR)),
@@ -97,6 +99,12 @@ static struct bt_conn_cb conn_callbacks = {
 
 bool zmk_split_bt_peripheral_is_connected() { return is_connected; }
 
+bool zmk_split_peripheral_is_connected(void) { return is_connected; }
+
+int zmk_split_peripheral_trackpad_report(const struct zmk_trackpad_data *data) {
+    return zmk_split_bt_trackpad_report(data);
+}
+
 static int zmk_peripheral_ble_init(const struct device *_arg) {
     int err = bt_enable(NULL);
 
@@ -7,12 +7,14 @@
 #include <drivers/sensor.h>
 #include <zephyr/types.h>
 #include <sys/util.h>
+#include <sys/byteorder.h>
 #include <init.h>
 
 #include <logging/log.h>
 
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
+#include <bluetooth/conn.h>
 #include <bluetooth/gatt.h>
 #include <bluetooth/uuid.h>
 
@@ -27,6 +29,7 @@ LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 struct sensor_event {
     uint8_t sensor_number;
     struct sensor_value value;
+    uint32_t timestamp_us;
 } sensor_event;
 
 static ssize_t split_svc_sensor_state(struct bt_conn *conn, const struct bt_gatt_attr *attrs,
@@ -52,6 +55,22 @@ static ssize_t split_svc_pos_state(struct bt_conn *conn, const struct bt_gatt_at
                              sizeof(position_state));
 }
 
+static void run_behavior(struct zmk_behavior_binding *binding, uint8_t position, bool pressed) {
+    LOG_DBG("%s with params %d %d: pressed? %d", log_strdup(binding->behavior_dev),
+            binding->param1, binding->param2, pressed);
+    struct zmk_behavior_binding_event event = {.position = position, .timestamp = k_uptime_get()};
+    int err;
+    if (pressed) {
+        err = behavior_keymap_binding_pressed(binding, event);
+    } else {
+        err = behavior_keymap_binding_released(binding, event);
+    }
+
+    if (err) {
+        LOG_ERR("Failed to invoke behavior %s: %d", log_strdup(binding->behavior_dev), err);
+    }
+}
+
 static ssize_t split_svc_run_behavior(struct bt_conn *conn, const struct bt_gatt_attr *attrs,
                                       const void *buf, uint16_t len, uint16_t offset,
                                       uint8_t flags) {
@@ -78,22 +97,128 @@ static ssize_t split_svc_run_behavior(struct bt_conn *conn, const struct bt_gatt
             .param2 = payload->data.param2,
             .behavior_dev = payload->behavior_dev,
         };
-        LOG_DBG("%s with params %d %d: pressed? %d", log_strdup(binding.behavior_dev),
-                binding.param1, binding.param2, payload->data.state);
-        struct zmk_behavior_binding_event event = {.position = payload->data.position,
-                                                   .timestamp = k_uptime_get()};
-        int err;
-        if (payload->data.state > 0) {
-            err = behavior_keymap_binding_pressed(&binding, event);
-        } else {
-            err = behavior_keymap_binding_released(&binding, event);
+        run_behavior(&binding, payload->data.position, payload->data.state > 0);
+    }
+
+    return len;
+}
+
+#define BEHAVIOR_ID_CACHE_SIZE 8
+
+static struct {
+    uint32_t id;
+    const struct device *dev;
+} behavior_id_cache[BEHAVIOR_ID_CACHE_SIZE];
+
+static uint8_t behavior_id_cache_next;
+
+// Set at init if two behaviors hash to the same ID, batches can't be run unambiguously then.
+// The central reads this before batching and falls back to invoking behaviors by label.
+static bool behavior_ids_collide;
+
+static const struct device *behavior_for_id(uint32_t id) {
+    for (int i = 0; i < BEHAVIOR_ID_CACHE_SIZE; i++) {
+        if (behavior_id_cache[i].dev != NULL && behavior_id_cache[i].id == id) {
+            return behavior_id_cache[i].dev;
         }
+    }
 
-        if (err) {
-            LOG_ERR("Failed to invoke behavior %s: %d", log_strdup(binding.behavior_dev), err);
+    for (const struct zmk_behavior_ref *ref = __zmk_behavior_refs_start;
+         ref < __zmk_behavior_refs_end; ref++) {
+        if (zmk_split_behavior_id(ref->device->name) == id) {
+            behavior_id_cache[behavior_id_cache_next].id = id;
+            behavior_id_cache[behavior_id_cache_next].dev = ref->device;
+            behavior_id_cache_next = (behavior_id_cache_next + 1) % BEHAVIOR_ID_CACHE_SIZE;
+            return ref->device;
+        }
+    }
+
+    return NULL;
+}
+
+static int check_behavior_ids() {
+    int err = 0;
+
+    for (const struct zmk_behavior_ref *a = __zmk_behavior_refs_start;
+         a < __zmk_behavior_refs_end; a++) {
+        uint32_t id = zmk_split_behavior_id(a->device->name);
+
+        for (const struct zmk_behavior_ref *b = a + 1; b < __zmk_behavior_refs_end; b++) {
+            if (zmk_split_behavior_id(b->device->name) == id) {
+                LOG_ERR("Behaviors %s and %s share the split behavior ID 0x%08X", a->device->name,
+                        b->device->name, id);
+                err = -EEXIST;
+            }
         }
     }
 
+    return err;
+}
+
+static ssize_t split_svc_run_behavior_batch_status(struct bt_conn *conn,
+                                                   const struct bt_gatt_attr *attrs, void *buf,
+                                                   uint16_t len, uint16_t offset) {
+    uint8_t status = behavior_ids_collide ? ZMK_SPLIT_RUN_BEHAVIOR_BATCH_STATUS_IDS_COLLIDE : 0;
+
+    return bt_gatt_attr_read(conn, attrs, buf, len, offset, &status, sizeof(status));
+}
+
+static ssize_t split_svc_run_behavior_batch(struct bt_conn *conn, const struct bt_gatt_attr *attrs,
+                                            const void *buf, uint16_t len, uint16_t offset,
+                                            uint8_t flags) {
+    const uint8_t *data = buf;
+
+    if (offset != 0) {
+        return BT_GATT_ERR(BT_ATT_ERR_INVALID_OFFSET);
+    }
+
+    if (len < 1 || data[0] != ZMK_SPLIT_RUN_BEHAVIOR_BATCH_VERSION) {
+        LOG_ERR("Unsupported behavior batch");
+        return BT_GATT_ERR(BT_ATT_ERR_VALUE_NOT_ALLOWED);
+    }
+
+    if (behavior_ids_collide) {
+        LOG_ERR("Behavior IDs aren't unique, refusing behavior batch");
+        return BT_GATT_ERR(BT_ATT_ERR_VALUE_NOT_ALLOWED);
+    }
+
+    uint16_t pos = 1;
+    while (pos + sizeof(struct zmk_split_run_behavior_record) <= len) {
+        const struct zmk_split_run_behavior_record *record =
+            (const struct zmk_split_run_behavior_record *)&data[pos];
+        pos += sizeof(*record);
+
+        uint32_t params[2] = {0, 0};
+        for (int i = 0; i < ARRAY_SIZE(params); i++) {
+            if (!(record->flags & (ZMK_SPLIT_RUN_BEHAVIOR_HAS_PARAM1 << i))) {
+                continue;
+            }
+
+            if (pos + sizeof(uint32_t) > len) {
+                LOG_ERR("Truncated behavior batch");
+                return BT_GATT_ERR(BT_ATT_ERR_INVALID_ATTRIBUTE_LEN);
+            }
+
+            params[i] = sys_get_le32(&data[pos]);
+            pos += sizeof(uint32_t);
+        }
+
+        uint32_t id = sys_le32_to_cpu(record->behavior_id);
+        const struct device *dev = behavior_for_id(id);
+        if (dev == NULL) {
+            LOG_ERR("No behavior found for ID 0x%08X", id);
+            continue;
+        }
+
+        // device_get_binding matches on the name pointer before comparing strings
+        struct zmk_behavior_binding binding = {
+            .behavior_dev = (char *)dev->name,
+            .param1 = params[0],
+            .param2 = params[1],
+        };
+        run_behavior(&binding, record->position, record->flags & ZMK_SPLIT_RUN_BEHAVIOR_PRESSED);
+    }
+
     return len;
 }
 
@@ -106,6 +231,24 @@ static void split_svc_pos_state_ccc(const struct bt_gatt_attr *attr, uint16_t va
     LOG_DBG("value %d", value);
 }
 
+static ssize_t split_svc_time_sync(struct bt_conn *conn, const struct bt_gatt_attr *attrs,
+                                   void *buf, uint16_t len, uint16_t offset) {
+    // Sampled per read so the central can estimate the offset between the two clocks
+    uint32_t now_us = sys_cpu_to_le32((uint32_t)k_ticks_to_us_floor64(k_uptime_ticks()));
+    return bt_gatt_attr_read(conn, attrs, buf, len, offset, &now_us, sizeof(now_us));
+}
+
+static void split_svc_motion_ccc(const struct bt_gatt_attr *attr, uint16_t value) {
+    LOG_DBG("value %d", value);
+}
+
+static bool event_log_enabled;
+
+static void split_svc_pos_events_ccc(const struct bt_gatt_attr *attr, uint16_t value) {
+    LOG_DBG("value %d", value);
+    event_log_enabled = (value == BT_GATT_CCC_NOTIFY);
+}
+
 BT_GATT_SERVICE_DEFINE(
     split_svc, BT_GATT_PRIMARY_SERVICE(BT_UUID_DECLARE_128(ZMK_SPLIT_BT_SERVICE_UUID)),
     BT_GATT_CHARACTERISTIC(BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_POSITION_STATE_UUID),
@@ -123,57 +266,241 @@ BT_GATT_SERVICE_DEFINE(
                            split_svc_sensor_state, NULL, &sensor_event),
     BT_GATT_CCC(split_svc_sensor_state_ccc, BT_GATT_PERM_READ_ENCRYPT | BT_GATT_PERM_WRITE_ENCRYPT),
 #endif /* ZMK_KEYMAP_HAS_SENSORS */
+    BT_GATT_CHARACTERISTIC(BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_POSITION_EVENTS_UUID),
+                           BT_GATT_CHRC_NOTIFY, BT_GATT_PERM_READ_ENCRYPT, NULL, NULL, NULL),
+    BT_GATT_CCC(split_svc_pos_events_ccc, BT_GATT_PERM_READ_ENCRYPT | BT_GATT_PERM_WRITE_ENCRYPT),
+    BT_GATT_CHARACTERISTIC(BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_TIME_SYNC_UUID), BT_GATT_CHRC_READ,
+                           BT_GATT_PERM_READ_ENCRYPT, split_svc_time_sync, NULL, NULL),
+    BT_GATT_CHARACTERISTIC(BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_RUN_BEHAVIOR_BATCH_UUID),
+                           BT_GATT_CHRC_READ | BT_GATT_CHRC_WRITE_WITHOUT_RESP,
+                           BT_GATT_PERM_READ_ENCRYPT | BT_GATT_PERM_WRITE_ENCRYPT,
+                           split_svc_run_behavior_batch_status, split_svc_run_behavior_batch, NULL),
+    BT_GATT_CHARACTERISTIC(BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_MOTION_UUID), BT_GATT_CHRC_NOTIFY,
+                           BT_GATT_PERM_READ_ENCRYPT, NULL, NULL, NULL),
+    BT_GATT_CCC(split_svc_motion_ccc, BT_GATT_PERM_READ_ENCRYPT | BT_GATT_PERM_WRITE_ENCRYPT),
 );
 
+// Value attributes of the notified characteristics, looked up once the service is registered
+static const struct bt_gatt_attr *pos_state_attr;
+static const struct bt_gatt_attr *pos_events_attr;
+#if ZMK_KEYMAP_HAS_SENSORS
+static const struct bt_gatt_attr *sensor_state_attr;
+#endif
+static const struct bt_gatt_attr *motion_attr;
+
+static const struct bt_gatt_attr *find_notify_attr(const struct bt_uuid *uuid) {
+    const struct bt_gatt_attr *end = split_svc.attrs + split_svc.attr_count;
+    const struct bt_gatt_attr *attr =
+        bt_gatt_find_by_uuid(split_svc.attrs, split_svc.attr_count, uuid);
+
+    // The sensor state shares its UUID with the run behavior characteristic, skip values that
+    // aren't notified. The characteristic declaration directly precedes its value attribute.
+    while (attr != NULL) {
+        if (attr != split_svc.attrs && bt_uuid_cmp(attr[-1].uuid, BT_UUID_GATT_CHRC) == 0 &&
+            (((struct bt_gatt_chrc *)attr[-1].user_data)->properties & BT_GATT_CHRC_NOTIFY)) {
+            return attr;
+        }
+
+        attr = attr + 1 < end ? bt_gatt_find_by_uuid(attr + 1, end - (attr + 1), uuid) : NULL;
+    }
+
+    return NULL;
+}
+
 K_THREAD_STACK_DEFINE(service_q_stack, CONFIG_ZMK_SPLIT_BLE_PERIPHERAL_STACK_SIZE);
 
 struct k_work_q service_work_q;
 
-K_MSGQ_DEFINE(position_state_msgq, sizeof(char[POS_STATE_LEN]),
+struct position_event {
+    uint8_t position;
+    bool pressed;
+    uint8_t seq;
+    uint32_t timestamp_us;
+};
+
+K_MSGQ_DEFINE(position_event_msgq, sizeof(struct position_event),
               CONFIG_ZMK_SPLIT_BLE_PERIPHERAL_POSITION_QUEUE_SIZE, 4);
 
+// Sequence number of the next queued record. Records dropped from a full queue still consume
+// theirs, which lets the central notice the gap and resync from the position state bitmap.
+static uint8_t next_seq;
+
+// Position state as last sent to the central, used for centrals without event log support
+static uint8_t notified_state[POS_STATE_LEN];
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_PERIPHERAL_COALESCE)
+// Events following a notification within one connection interval are held for up to that
+// interval. Notifications queued before the next connection event go out in it anyway, so holding
+// them costs little latency and lets one notification carry every change since the previous event.
+// An event after a quiet period is notified right away.
+static atomic_t coalesce_window_us = ATOMIC_INIT(CONFIG_ZMK_SPLIT_BLE_PERIPHERAL_COALESCE_MAX_US);
+static atomic_t last_notify_us;
+
+static inline uint32_t coalesce_now_us() {
+    return (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks());
+}
+
+static void set_coalesce_window(uint16_t interval) {
+    // Connection intervals are in 1.25ms units
+    atomic_set(&coalesce_window_us,
+               MIN(interval * 1250, CONFIG_ZMK_SPLIT_BLE_PERIPHERAL_COALESCE_MAX_US));
+}
+
+static void service_connected(struct bt_conn *conn, uint8_t err) {
+    struct bt_conn_info info;
+
+    if (err == 0 && bt_conn_get_info(conn, &info) == 0) {
+        set_coalesce_window(info.le.interval);
+    }
+}
+
+static void service_le_param_updated(struct bt_conn *conn, uint16_t interval, uint16_t latency,
+                                     uint16_t timeout) {
+    set_coalesce_window(interval);
+}
+
+static struct bt_conn_cb service_conn_callbacks = {
+    .connected = service_connected,
+    .le_param_updated = service_le_param_updated,
+};
+
+static void position_notify_started(void) { atomic_set(&last_notify_us, coalesce_now_us()); }
+
+static k_timeout_t position_notify_delay(void) {
+    // Flush early rather than drop events once the queue is full
+    if (k_msgq_num_free_get(&position_event_msgq) == 0) {
+        return K_NO_WAIT;
+    }
+
+    uint32_t window_us = atomic_get(&coalesce_window_us);
+    uint32_t elapsed_us = coalesce_now_us() - (uint32_t)atomic_get(&last_notify_us);
+    if (elapsed_us >= window_us) {
+        return K_NO_WAIT;
+    }
+
+    // Hold until one window after the previous notification
+    return K_USEC(window_us - elapsed_us);
+}
+#else
+static void position_notify_started(void) {}
+
+static k_timeout_t position_notify_delay(void) { return K_NO_WAIT; }
+#endif /* IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_PERIPHERAL_COALESCE) */
+
+static void notify_event_log(uint8_t *buf, uint8_t count) {
+    struct zmk_split_event_log_header *header = (struct zmk_split_event_log_header *)buf;
+    header->count = count;
+
+    int err = bt_gatt_notify(NULL, pos_events_attr, buf,
+                             sizeof(*header) + count * sizeof(struct zmk_split_event_log_record));
+    if (err) {
+        LOG_DBG("Error notifying %d", err);
+    }
+}
+
 void send_position_state_callback(struct k_work *work) {
-    uint8_t state[POS_STATE_LEN];
+    uint8_t buf[sizeof(struct zmk_split_event_log_header) +
+                ZMK_SPLIT_EVENT_LOG_MAX_RECORDS * sizeof(struct zmk_split_event_log_record)];
+    struct zmk_split_event_log_header *header = (struct zmk_split_event_log_header *)buf;
+    struct zmk_split_event_log_record *records =
+        (struct zmk_split_event_log_record *)(buf + sizeof(*header));
+    struct position_event ev;
+    uint8_t count = 0;
+    uint32_t last_us = 0;
+
+    position_notify_started();
+
+    while (k_msgq_get(&position_event_msgq, &ev, K_NO_WAIT) == 0) {
+        WRITE_BIT(notified_state[ev.position / 8], ev.position % 8, ev.pressed);
+
+        if (!event_log_enabled) {
+            int err =
+                bt_gatt_notify(NULL, pos_state_attr, &notified_state, sizeof(notified_state));
+            if (err) {
+                LOG_DBG("Error notifying %d", err);
+            }
+            continue;
+        }
 
-    while (k_msgq_get(&position_state_msgq, &state, K_NO_WAIT) == 0) {
-        int err = bt_gatt_notify(NULL, &split_svc.attrs[1], &state, sizeof(state));
-        if (err) {
-            LOG_DBG("Error notifying %d", err);
+        // Start a new notification if the record doesn't fit or doesn't follow the previous one
+        if (count > 0 &&
+            (count == ZMK_SPLIT_EVENT_LOG_MAX_RECORDS || ev.seq != (uint8_t)(header->seq + count) ||
+             ev.timestamp_us - last_us > UINT16_MAX)) {
+            notify_event_log(buf, count);
+            count = 0;
+        }
+
+        if (count == 0) {
+            header->version = ZMK_SPLIT_EVENT_LOG_VERSION;
+            header->seq = ev.seq;
+            header->timestamp_us = sys_cpu_to_le32(ev.timestamp_us);
+            last_us = ev.timestamp_us;
         }
+
+        records[count].position = ev.position | (ev.pressed ? ZMK_SPLIT_EVENT_LOG_PRESSED : 0);
+        records[count].delta_us = sys_cpu_to_le16(ev.timestamp_us - last_us);
+        last_us = ev.timestamp_us;
+        count++;
+    }
+
+    if (count > 0) {
+        notify_event_log(buf, count);
     }
 };
 
-K_WORK_DEFINE(service_position_notify_work, send_position_state_callback);
+K_WORK_DELAYABLE_DEFINE(service_position_notify_work, send_position_state_callback);
 
-int send_position_state() {
-    int err = k_msgq_put(&position_state_msgq, position_state, K_MSEC(100));
+static int queue_position_event(struct position_event *ev) {
+    int err = k_msgq_put(&position_event_msgq, ev, K_MSEC(100));
     if (err) {
         switch (err) {
         case -EAGAIN: {
-            LOG_WRN("Position state message queue full, popping first message and queueing again");
-            uint8_t discarded_state[POS_STATE_LEN];
-            k_msgq_get(&position_state_msgq, &discarded_state, K_NO_WAIT);
-            return send_position_state();
+            LOG_WRN("Position event message queue full, popping first message and queueing again");
+            struct position_event discarded_ev;
+            k_msgq_get(&position_event_msgq, &discarded_ev, K_NO_WAIT);
+            return queue_position_event(ev);
         }
         default:
-            LOG_WRN("Failed to queue position state to send (%d)", err);
+            LOG_WRN("Failed to queue position event to send (%d)", err);
             return err;
         }
     }
 
-    k_work_submit_to_queue(&service_work_q, &service_position_notify_work);
+    return 0;
+}
+
+static int send_position_event(uint8_t position, bool pressed) {
+    struct position_event ev = {
+        .position = position,
+        .pressed = pressed,
+        .seq = next_seq++,
+        .timestamp_us = (uint32_t)k_ticks_to_us_floor64(k_uptime_ticks()),
+    };
+
+    int err = queue_position_event(&ev);
+    if (err) {
+        return err;
+    }
+
+    k_timeout_t delay = position_notify_delay();
+    if (K_TIMEOUT_EQ(delay, K_NO_WAIT)) {
+        k_work_reschedule_for_queue(&service_work_q, &service_position_notify_work, delay);
+    } else {
+        // Keeps an already pending deadline, so the window starts at the first held event
+        k_work_schedule_for_queue(&service_work_q, &service_position_notify_work, delay);
+    }
 
     return 0;
 }
 
 int zmk_split_bt_position_pressed(uint8_t position) {
     WRITE_BIT(position_state[position / 8], position % 8, true);
-    return send_position_state();
+    return send_position_event(position, true);
 }
 
 int zmk_split_bt_position_released(uint8_t position) {
     WRITE_BIT(position_state[position / 8], position % 8, false);
-    return send_position_state();
+    return send_position_event(position, false);
 }
 
 #if ZMK_KEYMAP_HAS_SENSORS
@@ -184,7 +511,7 @@ void send_sensor_state_callback(struct k_work *work) {
     struct sensor_event ev;
 
     while (k_msgq_get(&sensor_state_msgq, &ev, K_NO_WAIT) == 0) {
-        int err = bt_gatt_notify(NULL, &split_svc.attrs[5], &ev, sizeof(ev));
+        int err = bt_gatt_notify(NULL, sensor_state_attr, &ev, sizeof(ev));
         if (err) {
             LOG_DBG("Error notifying %d", err);
         }
@@ -217,16 +544,104 @@ int send_sensor_state() {
 int zmk_split_bt_sensor_triggered(uint8_t sensor_number, struct sensor_value value) {
     sensor_event.sensor_number = sensor_number;
     sensor_event.value = value;
+    sensor_event.timestamp_us = sys_cpu_to_le32((uint32_t)k_ticks_to_us_floor64(k_uptime_ticks()));
     return send_sensor_state();
 }
 #endif /* ZMK_KEYMAP_HAS_SENSORS */
 
+K_MSGQ_DEFINE(motion_msgq, sizeof(struct zmk_split_motion_data),
+              CONFIG_ZMK_SPLIT_BLE_PERIPHERAL_POSITION_QUEUE_SIZE, 4);
+
+static struct k_spinlock motion_lock;
+// Latest motion, still open for merging with further samples
+static struct zmk_split_motion_data pending_motion;
+static bool motion_pending;
+
+static bool next_motion(struct zmk_split_motion_data *data) {
+    bool found = true;
+    k_spinlock_key_t key = k_spin_lock(&motion_lock);
+
+    if (k_msgq_get(&motion_msgq, data, K_NO_WAIT) != 0) {
+        found = motion_pending;
+        *data = pending_motion;
+        motion_pending = false;
+    }
+
+    k_spin_unlock(&motion_lock, key);
+    return found;
+}
+
+void send_motion_callback(struct k_work *work) {
+    struct zmk_split_motion_data data;
+
+    while (next_motion(&data)) {
+        int err = bt_gatt_notify(NULL, motion_attr, &data, sizeof(data));
+        if (err) {
+            LOG_DBG("Error notifying %d", err);
+        }
+    }
+}
+
+K_WORK_DEFINE(service_motion_notify_work, send_motion_callback);
+
+int zmk_split_bt_trackpad_report(const struct zmk_trackpad_data *data) {
+    k_spinlock_key_t key = k_spin_lock(&motion_lock);
+
+    // Finger count changes and gestures have to reach the central as separate samples
+    if (motion_pending && pending_motion.finger_count == data->finger_count &&
+        !pending_motion.gestures && !data->gestures) {
+        pending_motion.dx = CLAMP(pending_motion.dx + data->dx, INT16_MIN, INT16_MAX);
+        pending_motion.dy = CLAMP(pending_motion.dy + data->dy, INT16_MIN, INT16_MAX);
+    } else {
+        if (motion_pending && k_msgq_put(&motion_msgq, &pending_motion, K_NO_WAIT) != 0) {
+            LOG_WRN("Motion message queue full, dropping motion");
+        }
+
+        pending_motion = (struct zmk_split_motion_data){
+            .dx = data->dx,
+            .dy = data->dy,
+            .finger_count = data->finger_count,
+            .gestures = data->gestures,
+        };
+        motion_pending = true;
+    }
+
+    k_spin_unlock(&motion_lock, key);
+
+    k_work_submit_to_queue(&service_work_q, &service_motion_notify_work);
+    return 0;
+}
+
 int service_init(const struct device *_arg) {
     static const struct k_work_queue_config queue_config = {
         .name = "Split Peripheral Notification Queue"};
     k_work_queue_start(&service_work_q, service_q_stack, K_THREAD_STACK_SIZEOF(service_q_stack),
                        CONFIG_ZMK_SPLIT_BLE_PERIPHERAL_PRIORITY, &queue_config);
 
+    // Position events keep working, the central invokes behaviors by label instead of by ID
+    behavior_ids_collide = check_behavior_ids() != 0;
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_BLE_PERIPHERAL_COALESCE)
+    bt_conn_cb_register(&service_conn_callbacks);
+#endif
+
+    pos_state_attr = find_notify_attr(BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_POSITION_STATE_UUID));
+    pos_events_attr =
+        find_notify_attr(BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_POSITION_EVENTS_UUID));
+    motion_attr = find_notify_attr(BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_MOTION_UUID));
+    if (pos_state_attr == NULL || pos_events_attr == NULL || motion_attr == NULL) {
+        LOG_ERR("Split service is missing a notified characteristic");
+        return -ENODEV;
+    }
+
+#if ZMK_KEYMAP_HAS_SENSORS
+    sensor_state_attr = find_notify_attr(BT_UUID_DECLARE_128(ZMK_SPLIT_BT_CHAR_SENSOR_STATE_UUID));
+    if (sensor_state_attr == NULL) {
+        LOG_ERR("Split service is missing the sensor state characteristic");
+        return -ENODEV;
+    }
+#endif
+
     return 0;
 }
 
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2022 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <device.h>
+#include <init.h>
+#include <devicetree.h>
+#include <iqs5xx.h>
+
+#include <logging/log.h>
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/trackpad.h>
+#include <zmk/split/peripheral.h>
+
+// Mouse reports are built on the central, so the peripheral only forwards what the trackpad saw
+static void trackpad_peripheral_trigger_handler(const struct device *dev,
+                                                const struct iqs5xx_rawdata *data) {
+    struct zmk_trackpad_data trackpad_data = {
+        .dx = data->rx,
+        .dy = data->ry,
+        .finger_count = data->finger_count,
+        .gestures = ZMK_TRACKPAD_GESTURES(data->gestures0, data->gestures1),
+    };
+
+    zmk_split_peripheral_trackpad_report(&trackpad_data);
+}
+
+static int trackpad_peripheral_init(const struct device *_arg) {
+    const struct device *trackpad = DEVICE_DT_GET_ANY(azoteq_iqs5xx);
+    if (trackpad == NULL) {
+        LOG_ERR("Failed to get IQS5XX device");
+        return -EINVAL;
+    }
+
+    return iqs5xx_trigger_set(trackpad, trackpad_peripheral_trigger_handler);
+}
+
+SYS_INIT(trackpad_peripheral_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
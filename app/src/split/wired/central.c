@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2022 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <kernel.h>
+#include <init.h>
+#include <sys/byteorder.h>
+
+#include <logging/log.h>
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/behavior.h>
+#include <zmk/sensors.h>
+#include <zmk/trackpad.h>
+#include <zmk/split/central.h>
+#include <zmk/split/wired/wired.h>
+#include <zmk/split/bluetooth/service.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/position_state_changed.h>
+#include <zmk/events/sensor_event.h>
+#include <zmk/events/split_peripheral_status_changed.h>
+
+// The wired transport has a single peripheral on the other end of the cable
+#define WIRED_PERIPHERAL_SOURCE 0
+
+static bool is_connected = false;
+static uint8_t position_state[ZMK_SPLIT_WIRED_POSITION_STATE_LEN];
+
+static void set_connected(bool connected) {
+    is_connected = connected;
+
+    ZMK_EVENT_RAISE(new_zmk_split_peripheral_status_changed(
+        (struct zmk_split_peripheral_status_changed){.connected = is_connected}));
+}
+
+static void split_wired_central_release_all(void) {
+    int64_t timestamp = k_uptime_get();
+
+    for (int i = 0; i < ZMK_SPLIT_WIRED_POSITION_STATE_LEN; i++) {
+        for (int j = 0; j < 8; j++) {
+            if (position_state[i] & BIT(j)) {
+                ZMK_EVENT_RAISE(new_zmk_position_state_changed(
+                    (struct zmk_position_state_changed){.source = WIRED_PERIPHERAL_SOURCE,
+                                                        .position = (i * 8) + j,
+                                                        .state = false,
+                                                        .timestamp = timestamp}));
+            }
+        }
+        position_state[i] = 0U;
+    }
+}
+
+static void split_wired_central_position_state(const uint8_t *state) {
+    int64_t timestamp = k_uptime_get();
+
+    for (int i = 0; i < ZMK_SPLIT_WIRED_POSITION_STATE_LEN; i++) {
+        uint8_t changed = state[i] ^ position_state[i];
+        position_state[i] = state[i];
+
+        for (int j = 0; j < 8; j++) {
+            if (changed & BIT(j)) {
+                LOG_DBG("Trigger key position state change for %d", (i * 8) + j);
+                ZMK_EVENT_RAISE(new_zmk_position_state_changed(
+                    (struct zmk_position_state_changed){.source = WIRED_PERIPHERAL_SOURCE,
+                                                        .position = (i * 8) + j,
+                                                        .state = state[i] & BIT(j),
+                                                        .timestamp = timestamp}));
+            }
+        }
+    }
+}
+
+// Runs on the system work queue
+static void split_wired_central_handle_msg(uint8_t type, const uint8_t *data, size_t len) {
+    if (!is_connected) {
+        LOG_DBG("Peripheral connected");
+        set_connected(true);
+    }
+
+    switch (type) {
+    case ZMK_SPLIT_WIRED_MSG_HEARTBEAT:
+        break;
+    case ZMK_SPLIT_WIRED_MSG_POSITION_STATE:
+        if (len < ZMK_SPLIT_WIRED_POSITION_STATE_LEN) {
+            LOG_ERR("Position state message too short (%d)", len);
+            break;
+        }
+        split_wired_central_position_state(data);
+        break;
+#if ZMK_KEYMAP_HAS_SENSORS
+    case ZMK_SPLIT_WIRED_MSG_SENSOR_EVENT: {
+        const struct zmk_split_wired_sensor_event *sensor_event =
+            (const struct zmk_split_wired_sensor_event *)data;
+
+        if (len < sizeof(*sensor_event)) {
+            LOG_ERR("Sensor message too short (%d)", len);
+            break;
+        }
+
+        LOG_DBG("Trigger sensor change for %d", sensor_event->sensor_number);
+        ZMK_EVENT_RAISE(new_zmk_sensor_event((struct zmk_sensor_event){
+            .sensor_number = sensor_event->sensor_number,
+            .value = {.val1 = sys_le32_to_cpu(sensor_event->val1),
+                      .val2 = sys_le32_to_cpu(sensor_event->val2)},
+            .timestamp = k_uptime_get()}));
+        break;
+    }
+#endif /* ZMK_KEYMAP_HAS_SENSORS */
+    case ZMK_SPLIT_WIRED_MSG_MOTION: {
+        const struct zmk_split_motion_data *motion = (const struct zmk_split_motion_data *)data;
+
+        if (len < sizeof(*motion)) {
+            LOG_ERR("Motion message too short (%d)", len);
+            break;
+        }
+
+        struct zmk_trackpad_data trackpad_data = {
+            .dx = sys_le16_to_cpu(motion->dx),
+            .dy = sys_le16_to_cpu(motion->dy),
+            .finger_count = motion->finger_count,
+            .gestures = sys_le16_to_cpu(motion->gestures),
+        };
+        zmk_trackpad_process(&trackpad_data);
+        break;
+    }
+    default:
+        LOG_WRN("Unknown split message 0x%02X", type);
+        break;
+    }
+}
+
+static void split_wired_central_heartbeat_work_callback(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(split_wired_central_heartbeat_work,
+                               split_wired_central_heartbeat_work_callback);
+
+static void split_wired_central_heartbeat_work_callback(struct k_work *work) {
+    int64_t age = zmk_split_wired_last_rx_age();
+
+    if (is_connected && (age < 0 || age > CONFIG_ZMK_SPLIT_WIRED_TIMEOUT)) {
+        LOG_WRN("Peripheral stopped responding");
+        set_connected(false);
+        // Nothing more will arrive to release keys that were held when the cable came out
+        split_wired_central_release_all();
+    }
+
+    // Any frame keeps the peripheral's timeout from expiring, so only fill the gaps
+    int64_t tx_age = zmk_split_wired_last_tx_age();
+    if (tx_age >= 0 && tx_age < CONFIG_ZMK_SPLIT_WIRED_HEARTBEAT_INTERVAL) {
+        k_work_schedule(&split_wired_central_heartbeat_work,
+                        K_MSEC(CONFIG_ZMK_SPLIT_WIRED_HEARTBEAT_INTERVAL - tx_age));
+        return;
+    }
+
+    zmk_split_wired_send(ZMK_SPLIT_WIRED_MSG_HEARTBEAT, NULL, 0);
+
+    k_work_schedule(&split_wired_central_heartbeat_work,
+                    K_MSEC(CONFIG_ZMK_SPLIT_WIRED_HEARTBEAT_INTERVAL));
+}
+
+bool zmk_split_central_is_connected(void) { return is_connected; }
+
+int zmk_split_central_invoke_behavior(uint8_t source, struct zmk_behavior_binding *binding,
+                                      struct zmk_behavior_binding_event event, bool state) {
+    struct zmk_split_run_behavior_payload payload = {.data = {
+                                                         .param1 = binding->param1,
+                                                         .param2 = binding->param2,
+                                                         .position = event.position,
+                                                         .state = state ? 1 : 0,
+                                                     }};
+    const size_t payload_dev_size = sizeof(payload.behavior_dev);
+    if (strlcpy(payload.behavior_dev, binding->behavior_dev, payload_dev_size) >=
+        payload_dev_size) {
+        LOG_ERR("Truncated behavior label %s to %s before invoking peripheral behavior",
+                log_strdup(binding->behavior_dev), log_strdup(payload.behavior_dev));
+    }
+
+    if (!is_connected) {
+        return -ENOTCONN;
+    }
+
+    return zmk_split_wired_send(ZMK_SPLIT_WIRED_MSG_RUN_BEHAVIOR, &payload, sizeof(payload));
+}
+
+static int zmk_split_wired_central_init(const struct device *_arg) {
+    int err = zmk_split_wired_init(split_wired_central_handle_msg);
+    if (err) {
+        return err;
+    }
+
+    k_work_schedule(&split_wired_central_heartbeat_work, K_NO_WAIT);
+
+    return 0;
+}
+
+SYS_INIT(zmk_split_wired_central_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2022 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <kernel.h>
+#include <init.h>
+#include <sys/byteorder.h>
+#include <drivers/behavior.h>
+#include <drivers/sensor.h>
+
+#include <logging/log.h>
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/behavior.h>
+#include <zmk/sensors.h>
+#include <zmk/trackpad.h>
+#include <zmk/split/peripheral.h>
+#include <zmk/split/wired/wired.h>
+#include <zmk/split/bluetooth/service.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/position_state_changed.h>
+#include <zmk/events/sensor_event.h>
+#include <zmk/events/split_peripheral_status_changed.h>
+
+static bool is_connected = false;
+static uint8_t position_state[ZMK_SPLIT_WIRED_POSITION_STATE_LEN];
+
+static void set_connected(bool connected) {
+    if (connected == is_connected) {
+        return;
+    }
+
+    is_connected = connected;
+
+    ZMK_EVENT_RAISE(new_zmk_split_peripheral_status_changed(
+        (struct zmk_split_peripheral_status_changed){.connected = is_connected}));
+}
+
+// Every position message carries the whole state, so a corrupted frame is fixed by the next one
+static int send_position_state(void) {
+    return zmk_split_wired_send(ZMK_SPLIT_WIRED_MSG_POSITION_STATE, position_state,
+                                sizeof(position_state));
+}
+
+static void run_behavior(const struct zmk_split_run_behavior_payload *payload) {
+    char behavior_dev[ZMK_SPLIT_RUN_BEHAVIOR_DEV_LEN + 1] = {0};
+    memcpy(behavior_dev, payload->behavior_dev, ZMK_SPLIT_RUN_BEHAVIOR_DEV_LEN);
+
+    struct zmk_behavior_binding binding = {
+        .param1 = payload->data.param1,
+        .param2 = payload->data.param2,
+        .behavior_dev = behavior_dev,
+    };
+    struct zmk_behavior_binding_event event = {.position = payload->data.position,
+                                               .timestamp = k_uptime_get()};
+
+    LOG_DBG("%s with params %d %d: pressed? %d", log_strdup(binding.behavior_dev),
+            binding.param1, binding.param2, payload->data.state);
+
+    int err = payload->data.state ? behavior_keymap_binding_pressed(&binding, event)
+                                  : behavior_keymap_binding_released(&binding, event);
+    if (err) {
+        LOG_ERR("Failed to invoke behavior %s: %d", log_strdup(binding.behavior_dev), err);
+    }
+}
+
+// Runs on the system work queue
+static void split_wired_peripheral_handle_msg(uint8_t type, const uint8_t *data, size_t len) {
+    set_connected(true);
+
+    switch (type) {
+    case ZMK_SPLIT_WIRED_MSG_HEARTBEAT:
+        break;
+    case ZMK_SPLIT_WIRED_MSG_RUN_BEHAVIOR:
+        if (len < sizeof(struct zmk_split_run_behavior_payload)) {
+            LOG_ERR("Run behavior message too short (%d)", len);
+            break;
+        }
+        run_behavior((const struct zmk_split_run_behavior_payload *)data);
+        break;
+    default:
+        LOG_WRN("Unknown split message 0x%02X", type);
+        break;
+    }
+}
+
+static void split_wired_peripheral_heartbeat_work_callback(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(split_wired_peripheral_heartbeat_work,
+                               split_wired_peripheral_heartbeat_work_callback);
+
+static void split_wired_peripheral_heartbeat_work_callback(struct k_work *work) {
+    int64_t age = zmk_split_wired_last_rx_age();
+
+    if (age < 0 || age > CONFIG_ZMK_SPLIT_WIRED_TIMEOUT) {
+        set_connected(false);
+    }
+
+    send_position_state();
+
+    k_work_schedule(&split_wired_peripheral_heartbeat_work,
+                    K_MSEC(CONFIG_ZMK_SPLIT_WIRED_HEARTBEAT_INTERVAL));
+}
+
+bool zmk_split_peripheral_is_connected(void) { return is_connected; }
+
+int zmk_split_peripheral_trackpad_report(const struct zmk_trackpad_data *data) {
+    struct zmk_split_motion_data motion = {
+        .dx = sys_cpu_to_le16(data->dx),
+        .dy = sys_cpu_to_le16(data->dy),
+        .finger_count = data->finger_count,
+        .gestures = sys_cpu_to_le16(data->gestures),
+    };
+
+    return zmk_split_wired_send(ZMK_SPLIT_WIRED_MSG_MOTION, &motion, sizeof(motion));
+}
+
+static int split_wired_peripheral_listener(const zmk_event_t *eh) {
+    const struct zmk_position_state_changed *pos_ev = as_zmk_position_state_changed(eh);
+    if (pos_ev != NULL) {
+        if (pos_ev->position >= ZMK_SPLIT_WIRED_POSITION_STATE_LEN * 8) {
+            return -EINVAL;
+        }
+
+        WRITE_BIT(position_state[pos_ev->position / 8], pos_ev->position % 8, pos_ev->state);
+        send_position_state();
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+
+#if ZMK_KEYMAP_HAS_SENSORS
+    const struct zmk_sensor_event *sensor_ev = as_zmk_sensor_event(eh);
+    if (sensor_ev != NULL) {
+        struct zmk_split_wired_sensor_event msg = {
+            .sensor_number = sensor_ev->sensor_number,
+            .val1 = sys_cpu_to_le32(sensor_ev->value.val1),
+            .val2 = sys_cpu_to_le32(sensor_ev->value.val2),
+        };
+
+        zmk_split_wired_send(ZMK_SPLIT_WIRED_MSG_SENSOR_EVENT, &msg, sizeof(msg));
+        return ZMK_EV_EVENT_BUBBLE;
+    }
+#endif /* ZMK_KEYMAP_HAS_SENSORS */
+
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(split_wired_peripheral, split_wired_peripheral_listener);
+ZMK_SUBSCRIPTION(split_wired_peripheral, zmk_position_state_changed);
+
+#if ZMK_KEYMAP_HAS_SENSORS
+ZMK_SUBSCRIPTION(split_wired_peripheral, zmk_sensor_event);
+#endif /* ZMK_KEYMAP_HAS_SENSORS */
+
+static int zmk_split_wired_peripheral_init(const struct device *_arg) {
+    int err = zmk_split_wired_init(split_wired_peripheral_handle_msg);
+    if (err) {
+        return err;
+    }
+
+    k_work_schedule(&split_wired_peripheral_heartbeat_work, K_NO_WAIT);
+
+    return 0;
+}
+
+SYS_INIT(zmk_split_wired_peripheral_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
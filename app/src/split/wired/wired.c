@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2022 The ZMK Contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <device.h>
+#include <devicetree.h>
+#include <kernel.h>
+#include <drivers/uart.h>
+#include <sys/crc.h>
+#include <string.h>
+
+#include <logging/log.h>
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#include <zmk/split/wired/wired.h>
+
+#if !IS_ENABLED(CONFIG_ZMK_SPLIT_WIRED_UART_MODE_LOOPBACK)
+
+BUILD_ASSERT(DT_HAS_CHOSEN(zmk_split_uart),
+             "CONFIG_ZMK_SPLIT_WIRED is enabled but no zmk,split-uart chosen node found");
+
+static const struct device *const uart = DEVICE_DT_GET(DT_CHOSEN(zmk_split_uart));
+
+#endif
+
+struct wired_rx_frame {
+    uint8_t len;
+    uint8_t data[ZMK_SPLIT_WIRED_MAX_FRAME_LEN];
+};
+
+K_MSGQ_DEFINE(wired_rx_msgq, sizeof(struct wired_rx_frame), CONFIG_ZMK_SPLIT_WIRED_RX_QUEUE_SIZE,
+              4);
+
+static zmk_split_wired_msg_handler_t msg_handler;
+
+// Frame being assembled from received bytes, up to the next delimiter
+static struct wired_rx_frame rx_frame;
+static bool rx_overflow;
+
+static int64_t last_rx_time = -1;
+static int64_t last_tx_time = -1;
+
+K_MUTEX_DEFINE(wired_tx_mutex);
+static uint8_t tx_buf[ZMK_SPLIT_WIRED_MAX_FRAME_LEN];
+
+static size_t cobs_encode(const uint8_t *src, size_t len, uint8_t *dst) {
+    size_t code_idx = 0;
+    size_t out = 1;
+    uint8_t code = 1;
+
+    for (size_t i = 0; i < len; i++) {
+        if (src[i] == 0) {
+            dst[code_idx] = code;
+            code_idx = out++;
+            code = 1;
+            continue;
+        }
+
+        dst[out++] = src[i];
+        if (++code == 0xFF) {
+            dst[code_idx] = code;
+            code_idx = out++;
+            code = 1;
+        }
+    }
+
+    dst[code_idx] = code;
+    return out;
+}
+
+static int cobs_decode(const uint8_t *src, size_t len, uint8_t *dst, size_t dst_len) {
+    size_t out = 0;
+
+    for (size_t i = 0; i < len;) {
+        uint8_t code = src[i++];
+        if (code == 0 || i + code - 1 > len) {
+            return -EINVAL;
+        }
+
+        for (uint8_t j = 1; j < code; j++) {
+            if (out >= dst_len) {
+                return -ENOMEM;
+            }
+            dst[out++] = src[i++];
+        }
+
+        if (code != 0xFF && i < len) {
+            if (out >= dst_len) {
+                return -ENOMEM;
+            }
+            dst[out++] = 0;
+        }
+    }
+
+    return out;
+}
+
+static void wired_rx_work_callback(struct k_work *work) {
+    struct wired_rx_frame frame;
+    uint8_t msg[ZMK_SPLIT_WIRED_MAX_MSG_LEN + 2];
+
+    while (k_msgq_get(&wired_rx_msgq, &frame, K_NO_WAIT) == 0) {
+        int len = cobs_decode(frame.data, frame.len, msg, sizeof(msg));
+        if (len < 2) {
+            LOG_WRN("Discarding malformed split frame (%d)", len);
+            continue;
+        }
+
+        if (crc8_ccitt(0, msg, len - 1) != msg[len - 1]) {
+            LOG_WRN("Discarding split frame with bad CRC");
+            continue;
+        }
+
+        LOG_DBG("Received split message 0x%02X, %d bytes, crc 0x%02X", msg[0], len - 2,
+                msg[len - 1]);
+
+        last_rx_time = k_uptime_get();
+        msg_handler(msg[0], &msg[1], len - 2);
+    }
+}
+
+K_WORK_DEFINE(wired_rx_work, wired_rx_work_callback);
+
+// Called from the UART interrupt in async mode
+static void wired_rx_feed(const uint8_t *data, size_t len) {
+    bool queued = false;
+
+    for (size_t i = 0; i < len; i++) {
+        if (data[i] != ZMK_SPLIT_WIRED_FRAME_DELIMITER) {
+            if (rx_frame.len < sizeof(rx_frame.data)) {
+                rx_frame.data[rx_frame.len++] = data[i];
+            } else {
+                rx_overflow = true;
+            }
+            continue;
+        }
+
+        if (rx_frame.len > 0 && !rx_overflow) {
+            if (k_msgq_put(&wired_rx_msgq, &rx_frame, K_NO_WAIT) == 0) {
+                queued = true;
+            } else {
+                LOG_WRN("Split receive queue full, dropping frame");
+            }
+        }
+
+        rx_frame.len = 0;
+        rx_overflow = false;
+    }
+
+    if (queued) {
+        k_work_submit(&wired_rx_work);
+    }
+}
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_WIRED_UART_MODE_ASYNC)
+
+// Flush partial receive buffers once the line has been idle for about ten bytes at 1 Mbaud
+#define WIRED_RX_TIMEOUT_US 100
+#define WIRED_RX_BUF_SIZE 64
+
+static uint8_t rx_bufs[2][WIRED_RX_BUF_SIZE];
+static uint8_t rx_next_buf;
+
+K_SEM_DEFINE(wired_tx_done_sem, 1, 1);
+
+static int wired_rx_enable(void) {
+    rx_next_buf = 1;
+    return uart_rx_enable(uart, rx_bufs[0], sizeof(rx_bufs[0]), WIRED_RX_TIMEOUT_US);
+}
+
+static void wired_rx_restart_work_callback(struct k_work *work) {
+    int err = wired_rx_enable();
+    if (err) {
+        LOG_ERR("Failed to restart split UART receive (err %d)", err);
+    }
+}
+
+K_WORK_DEFINE(wired_rx_restart_work, wired_rx_restart_work_callback);
+
+static void wired_uart_callback(const struct device *dev, struct uart_event *evt,
+                                void *user_data) {
+    switch (evt->type) {
+    case UART_TX_DONE:
+    case UART_TX_ABORTED:
+        k_sem_give(&wired_tx_done_sem);
+        break;
+    case UART_RX_RDY:
+        wired_rx_feed(evt->data.rx.buf + evt->data.rx.offset, evt->data.rx.len);
+        break;
+    case UART_RX_BUF_REQUEST:
+        uart_rx_buf_rsp(dev, rx_bufs[rx_next_buf], sizeof(rx_bufs[0]));
+        rx_next_buf = !rx_next_buf;
+        break;
+    case UART_RX_STOPPED:
+        LOG_WRN("Split UART receive stopped (reason %d)", evt->data.rx_stop.reason);
+        break;
+    case UART_RX_DISABLED:
+        // Errors and breaks, e.g. while the other half is unplugged, disable receiving
+        rx_frame.len = 0;
+        rx_overflow = false;
+        k_work_submit(&wired_rx_restart_work);
+        break;
+    default:
+        break;
+    }
+}
+
+static int wired_uart_start(void) {
+    int err = uart_callback_set(uart, wired_uart_callback, NULL);
+    if (err) {
+        LOG_ERR("Failed to set split UART callback (err %d)", err);
+        return err;
+    }
+
+    return wired_rx_enable();
+}
+
+static int wired_uart_write(const uint8_t *buf, size_t len) {
+    int err = uart_tx(uart, buf, len, SYS_FOREVER_US);
+    if (err) {
+        k_sem_give(&wired_tx_done_sem);
+    }
+
+    return err;
+}
+
+#elif IS_ENABLED(CONFIG_ZMK_SPLIT_WIRED_UART_MODE_LOOPBACK)
+
+static int wired_uart_start(void) { return 0; }
+
+static int wired_uart_write(const uint8_t *buf, size_t len) {
+    wired_rx_feed(buf, len);
+    return 0;
+}
+
+#else
+
+static void wired_poll_work_callback(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(wired_poll_work, wired_poll_work_callback);
+
+static void wired_poll_work_callback(struct k_work *work) {
+    uint8_t c;
+
+    while (uart_poll_in(uart, &c) == 0) {
+        wired_rx_feed(&c, 1);
+    }
+
+    k_work_schedule(&wired_poll_work, K_MSEC(CONFIG_ZMK_SPLIT_WIRED_POLLING_INTERVAL));
+}
+
+static int wired_uart_start(void) {
+    k_work_schedule(&wired_poll_work, K_NO_WAIT);
+    return 0;
+}
+
+static int wired_uart_write(const uint8_t *buf, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        uart_poll_out(uart, buf[i]);
+    }
+
+    return 0;
+}
+
+#endif /* IS_ENABLED(CONFIG_ZMK_SPLIT_WIRED_UART_MODE_ASYNC) */
+
+int zmk_split_wired_send(uint8_t type, const void *data, size_t len) {
+    uint8_t msg[ZMK_SPLIT_WIRED_MAX_MSG_LEN + 2];
+
+    if (len > ZMK_SPLIT_WIRED_MAX_MSG_LEN) {
+        return -EINVAL;
+    }
+
+    msg[0] = type;
+    if (len > 0) {
+        memcpy(&msg[1], data, len);
+    }
+    msg[len + 1] = crc8_ccitt(0, msg, len + 1);
+
+    k_mutex_lock(&wired_tx_mutex, K_FOREVER);
+
+#if IS_ENABLED(CONFIG_ZMK_SPLIT_WIRED_UART_MODE_ASYNC)
+    // tx_buf is owned by the UART until the previous frame is out
+    if (k_sem_take(&wired_tx_done_sem, K_MSEC(10)) != 0) {
+        LOG_WRN("Previous split frame still sending, aborting it");
+        uart_tx_abort(uart);
+        k_sem_take(&wired_tx_done_sem, K_MSEC(10));
+    }
+#endif
+
+    size_t frame_len = cobs_encode(msg, len + 2, tx_buf);
+    tx_buf[frame_len++] = ZMK_SPLIT_WIRED_FRAME_DELIMITER;
+
+    int err = wired_uart_write(tx_buf, frame_len);
+    if (!err) {
+        last_tx_time = k_uptime_get();
+    }
+
+    k_mutex_unlock(&wired_tx_mutex);
+
+    if (err) {
+        LOG_ERR("Failed to send split frame 0x%02X (err %d)", type, err);
+    }
+
+    return err;
+}
+
+int64_t zmk_split_wired_last_rx_age(void) {
+    if (last_rx_time < 0) {
+        return -1;
+    }
+
+    return k_uptime_get() - last_rx_time;
+}
+
+int64_t zmk_split_wired_last_tx_age(void) {
+    if (last_tx_time < 0) {
+        return -1;
+    }
+
+    return k_uptime_get() - last_tx_time;
+}
+
+int zmk_split_wired_init(zmk_split_wired_msg_handler_t handler) {
+#if !IS_ENABLED(CONFIG_ZMK_SPLIT_WIRED_UART_MODE_LOOPBACK)
+    if (!device_is_ready(uart)) {
+        LOG_ERR("Split UART device %s is not ready", uart->name);
+        return -ENODEV;
+    }
+#endif
+
+    msg_handler = handler;
+
+    return wired_uart_start();
+}
@@ -6,6 +6,7 @@
 
 #include <device.h>
 #include <init.h>
+#include <sys/atomic.h>
 
 #include <usb/usb_device.h>
 #include <usb/class/usb_hid.h>
@@ -14,18 +15,206 @@
 #include <zmk/hid.h>
 #include <zmk/keymap.h>
 #include <zmk/event_manager.h>
+#include <zmk/events/usb_conn_state_changed.h>
 
 #include <zmk/control.h>
 
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
-static const struct device *hid_dev;
+#define USB_HID_MAX_REPORT_SIZE                                                                    \
+    MAX(ZMK_CONTROL_REPORT_SIZE,                                                                   \
+        MAX(sizeof(struct zmk_hid_keyboard_report),                                                \
+            MAX(sizeof(struct zmk_hid_consumer_report), sizeof(struct zmk_hid_mouse_report))))
 
-static K_SEM_DEFINE(hid_sem, 1, 1);
+// The host polls at least this often while configured, a longer wait means the IN-complete was lost
+#define USB_HID_IN_TIMEOUT_MS 30
+// Delay before writing a report again after the endpoint refused it
+#define USB_HID_RETRY_MS 2
 
-static void in_ready_cb(const struct device *dev) { k_sem_give(&hid_sem); }
+struct usb_hid_queued_report {
+    uint8_t len;
+    uint8_t data[USB_HID_MAX_REPORT_SIZE];
+};
+
+// Queues are drained in order, so keyboard/consumer reports always go out before
+// mouse and control protocol traffic sharing the same interrupt endpoint.
+K_MSGQ_DEFINE(usb_hid_key_msgq, sizeof(struct usb_hid_queued_report),
+              CONFIG_ZMK_USB_HID_REPORT_QUEUE_SIZE, 4);
+K_MSGQ_DEFINE(usb_hid_mouse_msgq, sizeof(struct usb_hid_queued_report),
+              CONFIG_ZMK_USB_HID_MOUSE_REPORT_QUEUE_SIZE, 4);
+K_MSGQ_DEFINE(usb_hid_control_msgq, sizeof(struct usb_hid_queued_report),
+              CONFIG_ZMK_USB_HID_CONTROL_REPORT_QUEUE_SIZE, 4);
+
+struct usb_hid_iface {
+    const char *label;
+    const struct device *dev;
+    // Set while a report is in flight on the interrupt IN endpoint
+    atomic_t busy;
+    // Uptime the report in flight was written
+    int64_t busy_since;
+    // Retries a refused write and recovers from a lost IN-complete
+    struct k_work_delayable retry_work;
+    struct k_msgq *queues[3];
+};
+
+static struct usb_hid_iface keyboard_iface = {
+    .label = "HID_0",
+#if IS_ENABLED(CONFIG_ZMK_USB_HID_MOUSE_INTERFACE)
+    .queues = {&usb_hid_key_msgq, &usb_hid_control_msgq, NULL},
+#else
+    .queues = {&usb_hid_key_msgq, &usb_hid_mouse_msgq, &usb_hid_control_msgq},
+#endif
+};
+
+#if IS_ENABLED(CONFIG_ZMK_USB_HID_MOUSE_INTERFACE)
+static struct usb_hid_iface mouse_iface = {
+    .label = "HID_1",
+    .queues = {&usb_hid_mouse_msgq, NULL, NULL},
+};
+#endif
+
+static struct usb_hid_iface *iface_for_dev(const struct device *dev) {
+#if IS_ENABLED(CONFIG_ZMK_USB_HID_MOUSE_INTERFACE)
+    if (dev == mouse_iface.dev) {
+        return &mouse_iface;
+    }
+#endif
+    return &keyboard_iface;
+}
+
+static bool iface_has_pending(struct usb_hid_iface *iface) {
+    for (int i = 0; i < ARRAY_SIZE(iface->queues) && iface->queues[i] != NULL; i++) {
+        if (k_msgq_num_used_get(iface->queues[i]) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Writes the next queued report. Returns 0 if a report is now in flight. A report the endpoint
+// refuses stays at the head of its queue.
+static int iface_send_next(struct usb_hid_iface *iface) {
+    struct usb_hid_queued_report report;
+
+    for (int i = 0; i < ARRAY_SIZE(iface->queues) && iface->queues[i] != NULL; i++) {
+        if (k_msgq_peek(iface->queues[i], &report) != 0) {
+            continue;
+        }
+
+        int err = hid_int_ep_write(iface->dev, report.data, report.len, NULL);
+        if (err) {
+            LOG_WRN("Failed to write report 0x%02X to %s (%d)", report.data[0], iface->label, err);
+            return err;
+        }
+
+        k_msgq_get(iface->queues[i], &report, K_NO_WAIT);
+        return 0;
+    }
+
+    return -ENODATA;
+}
+
+static void iface_drain(struct usb_hid_iface *iface) {
+    while (atomic_cas(&iface->busy, 0, 1)) {
+        iface->busy_since = k_uptime_get();
+
+        int err = iface_send_next(iface);
+        if (err == 0) {
+            // in_ready_cb continues draining once the host has polled this report
+            k_work_reschedule(&iface->retry_work, K_MSEC(USB_HID_IN_TIMEOUT_MS));
+            return;
+        }
+
+        atomic_clear(&iface->busy);
+
+        if (err != -ENODATA) {
+            k_work_reschedule(&iface->retry_work, K_MSEC(USB_HID_RETRY_MS));
+            return;
+        }
+
+        // A report may have been queued between the last dequeue and clearing the flag
+        if (!iface_has_pending(iface)) {
+            return;
+        }
+    }
+}
+
+static void iface_retry_work_callback(struct k_work *work) {
+    struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+    struct usb_hid_iface *iface = CONTAINER_OF(dwork, struct usb_hid_iface, retry_work);
+
+    // Writes fail until the bus is back, the status listener drains then
+    switch (zmk_usb_get_status()) {
+    case USB_DC_SUSPEND:
+    case USB_DC_ERROR:
+    case USB_DC_RESET:
+    case USB_DC_DISCONNECTED:
+    case USB_DC_UNKNOWN:
+        return;
+    default:
+        break;
+    }
+
+    if (atomic_get(&iface->busy) &&
+        k_uptime_get() - iface->busy_since >= USB_HID_IN_TIMEOUT_MS) {
+        LOG_WRN("No IN-complete on %s, sending the next report", iface->label);
+        atomic_clear(&iface->busy);
+    }
+
+    iface_drain(iface);
+}
 
-static void out_ready_cb(const struct device *dev) { 
+static void iface_purge(struct usb_hid_iface *iface) {
+    for (int i = 0; i < ARRAY_SIZE(iface->queues) && iface->queues[i] != NULL; i++) {
+        k_msgq_purge(iface->queues[i]);
+    }
+    atomic_clear(&iface->busy);
+}
+
+// A transfer in flight is aborted by a reset or suspend, so its IN-complete never arrives
+static void iface_status_changed(struct usb_hid_iface *iface, enum usb_dc_status_code status) {
+    switch (status) {
+    case USB_DC_CONFIGURED:
+    case USB_DC_RESUME:
+        atomic_clear(&iface->busy);
+        iface_drain(iface);
+        break;
+    case USB_DC_SUSPEND:
+        // Reports queued meanwhile go out after the wakeup request resumes the bus
+        atomic_clear(&iface->busy);
+        break;
+    case USB_DC_ERROR:
+    case USB_DC_RESET:
+    case USB_DC_DISCONNECTED:
+        iface_purge(iface);
+        break;
+    default:
+        break;
+    }
+}
+
+static int usb_hid_listener(const zmk_event_t *eh) {
+    enum usb_dc_status_code status = zmk_usb_get_status();
+
+    iface_status_changed(&keyboard_iface, status);
+#if IS_ENABLED(CONFIG_ZMK_USB_HID_MOUSE_INTERFACE)
+    iface_status_changed(&mouse_iface, status);
+#endif
+
+    return ZMK_EV_EVENT_BUBBLE;
+}
+
+ZMK_LISTENER(usb_hid, usb_hid_listener);
+ZMK_SUBSCRIPTION(usb_hid, zmk_usb_conn_state_changed);
+
+static void in_ready_cb(const struct device *dev) {
+    struct usb_hid_iface *iface = iface_for_dev(dev);
+
+    atomic_clear(&iface->busy);
+    iface_drain(iface);
+}
+
+static void out_ready_cb(const struct device *dev) {
     uint8_t buff[64];
     memset(buff, 0, 64);
     uint32_t rlen = 0;
@@ -50,7 +239,39 @@ static const struct hid_ops ops = {
 #endif
 };
 
+#if IS_ENABLED(CONFIG_ZMK_USB_HID_MOUSE_INTERFACE)
+static const struct hid_ops mouse_ops = {
+    .int_in_ready = in_ready_cb,
+};
+#endif
+
+static int queue_report(struct k_msgq *msgq, const uint8_t *report, size_t len) {
+    struct usb_hid_queued_report queued = {.len = len};
+    memcpy(queued.data, report, len);
+
+    if (msgq != &usb_hid_mouse_msgq) {
+        // Every keyboard/consumer report is a key transition the host has to see, so wait for
+        // in_ready_cb to free a slot, bounded like the old endpoint handshake. Control responses
+        // are sent from the control thread, which can afford the same wait.
+        return k_msgq_put(msgq, &queued, K_MSEC(30));
+    }
+
+    int err = k_msgq_put(msgq, &queued, K_NO_WAIT);
+    if (err == -ENOMSG) {
+        LOG_WRN("USB mouse report queue full, popping first message and queueing again");
+        struct usb_hid_queued_report discarded_report;
+        k_msgq_get(msgq, &discarded_report, K_NO_WAIT);
+        err = k_msgq_put(msgq, &queued, K_NO_WAIT);
+    }
+
+    return err;
+}
+
 int zmk_usb_hid_send_report(const uint8_t *report, size_t len) {
+    if (len > USB_HID_MAX_REPORT_SIZE) {
+        return -EINVAL;
+    }
+
     switch (zmk_usb_get_status()) {
     case USB_DC_SUSPEND:
         return usb_wakeup_request();
@@ -58,28 +279,71 @@ int zmk_usb_hid_send_report(const uint8_t *report, size_t len) {
     case USB_DC_RESET:
     case USB_DC_DISCONNECTED:
     case USB_DC_UNKNOWN:
+        iface_purge(&keyboard_iface);
+#if IS_ENABLED(CONFIG_ZMK_USB_HID_MOUSE_INTERFACE)
+        iface_purge(&mouse_iface);
+#endif
         return -ENODEV;
     default:
-        k_sem_take(&hid_sem, K_MSEC(30));
-        int err = hid_int_ep_write(hid_dev, report, len, NULL);
+        break;
+    }
 
-        if (err) {
-            k_sem_give(&hid_sem);
-        }
+    struct usb_hid_iface *iface = &keyboard_iface;
+    struct k_msgq *msgq;
+
+    switch (report[0]) {
+    case 0x04:
+        msgq = &usb_hid_mouse_msgq;
+#if IS_ENABLED(CONFIG_ZMK_USB_HID_MOUSE_INTERFACE)
+        iface = &mouse_iface;
+#endif
+        break;
+    case 0x05:
+        msgq = &usb_hid_control_msgq;
+        break;
+    default:
+        msgq = &usb_hid_key_msgq;
+        break;
+    }
 
+    int err = queue_report(msgq, report, len);
+    if (err) {
+        LOG_WRN("Failed to queue USB report 0x%02X (%d)", report[0], err);
         return err;
     }
+
+    iface_drain(iface);
+
+    return 0;
 }
 
 static int zmk_usb_hid_init(const struct device *_arg) {
-    hid_dev = device_get_binding("HID_0");
-    if (hid_dev == NULL) {
+    k_work_init_delayable(&keyboard_iface.retry_work, iface_retry_work_callback);
+#if IS_ENABLED(CONFIG_ZMK_USB_HID_MOUSE_INTERFACE)
+    k_work_init_delayable(&mouse_iface.retry_work, iface_retry_work_callback);
+#endif
+
+    keyboard_iface.dev = device_get_binding(keyboard_iface.label);
+    if (keyboard_iface.dev == NULL) {
         LOG_ERR("Unable to locate HID device");
         return -EINVAL;
     }
 
-    usb_hid_register_device(hid_dev, zmk_hid_report_desc, sizeof(zmk_hid_report_desc), &ops);
-    usb_hid_init(hid_dev);
+    usb_hid_register_device(keyboard_iface.dev, zmk_hid_report_desc, sizeof(zmk_hid_report_desc),
+                            &ops);
+    usb_hid_init(keyboard_iface.dev);
+
+#if IS_ENABLED(CONFIG_ZMK_USB_HID_MOUSE_INTERFACE)
+    mouse_iface.dev = device_get_binding(mouse_iface.label);
+    if (mouse_iface.dev == NULL) {
+        LOG_ERR("Unable to locate mouse HID device");
+        return -EINVAL;
+    }
+
+    usb_hid_register_device(mouse_iface.dev, zmk_hid_mouse_report_desc,
+                            sizeof(zmk_hid_mouse_report_desc), &mouse_ops);
+    usb_hid_init(mouse_iface.dev);
+#endif
 
     return 0;
 }